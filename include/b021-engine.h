@@ -0,0 +1,861 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef B021_ENGINE_H
+#define B021_ENGINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* | 매크로 정의... | */
+
+#define BLACKJACK           21
+
+#define DEALER_STAND_TOTAL  17
+
+#define MAX_CARD_NUMBER     13
+#define MAX_CARD_COUNT      52
+#define MAX_DECK_COUNT      8
+#define MAX_SHOE_CARD_COUNT (MAX_DECK_COUNT * MAX_CARD_COUNT)
+#define MAX_HAND_COUNT      21
+#define MAX_SPLIT_HAND_COUNT 4
+#define MAX_SEAT_COUNT      7
+
+#define RANK_COUNT          10
+
+#define DEALER_CACHE_SIZE   16384
+#define SOLVER_CACHE_SIZE   65536
+
+#define DEFAULT_DECK_COUNT  6
+#define DEFAULT_PENETRATION 0.75f
+#define DEFAULT_SPLIT_HAND_COUNT  MAX_SPLIT_HAND_COUNT
+#define DEFAULT_SEAT_COUNT  1
+
+#define MIN_PENETRATION     0.25f
+#define MAX_PENETRATION     0.95f
+
+#define HISTOGRAM_BIN_COUNT   256
+
+#define SKETCH_BUCKET_COUNT   2048
+#define SKETCH_MIN_VALUE      1.0e-3
+#define SKETCH_GAMMA          1.02
+
+#define CHART_HARD_ROW_COUNT  16
+#define CHART_SOFT_ROW_COUNT  8
+#define CHART_PAIR_ROW_COUNT  RANK_COUNT
+#define CHART_ROW_COUNT       (CHART_HARD_ROW_COUNT + CHART_SOFT_ROW_COUNT + CHART_PAIR_ROW_COUNT)
+#define CHART_COLUMN_COUNT    RANK_COUNT
+#define CHART_VERSION         2
+
+#define BOT_ROW_COUNT         (CHART_ROW_COUNT + 2)
+#define BOT_TOTAL_COUNT       32
+#define BOT_BUCKET_COUNT      3
+#define BOT_ACTION_MASK_COUNT (1 << PA_INSURANCE)
+
+#define REPLAY_VERSION        3
+#define REPLAY_HEADER_SIZE    32
+#define REPLAY_PAYOUT_SCALE   20
+#define MAX_REPLAY_STREAM     256
+
+#define HOST_SLAB_TABLE_COUNT 256
+#define HOST_EVENT_QUEUE_SIZE 8
+#define HOST_INDEX_BITS       32
+#define HOST_INVALID_TABLE    UINT64_MAX
+
+#define HAND_SCORE_BUST       (BLACKJACK + 1)
+#define HAND_SCORE_BLACKJACK  (BLACKJACK + 2)
+#define HAND_SCORE_COUNT      (BLACKJACK + 3)
+
+/* 블랙잭 카드의 무늬와 인덱스로 카드를 만든다. */
+#define MAKE_CARD(suit, index)  ((Card) (((suit) << 4) | (index)))
+
+/* 블랙잭 카드의 무늬를 반환한다. */
+#define GET_CARD_SUIT(card)     ((CardSuit) ((card) >> 4))
+
+/* 블랙잭 카드의 인덱스를 반환한다. */
+#define GET_CARD_INDEX(card)    ((int) ((card) & 0x0F))
+
+/* | 자료형 정의... | */
+
+/* 블랙잭 카드의 무늬를 나타내는 열거형. */
+typedef enum CardSuit {
+    SU_HEART,    // 하트 무늬.
+    SU_DIAMOND,  // 다이아몬드 무늬.
+    SU_CLOVER,   // 클로버 무늬.
+    SU_SPADE,    // 스페이드 무늬.
+    _SU_COUNT
+} CardSuit;
+
+/*
+    블랙잭 카드의 정보를 나타내는 자료형.
+
+    상위 4비트는 카드의 무늬, 하위 4비트는 카드의 인덱스를 나타낸다.
+*/
+typedef uint8_t Card;
+
+/* 블랙잭 카드 패의 상태를 나타내는 열거형. */
+typedef enum HandFlag {
+    HF_ACE       = 0x01,  // 에이스가 있는 패.
+    HF_SOFT      = 0x02,  // 에이스를 11로 계산한 패.
+    HF_PAIR      = 0x04,  // 값이 같은 두 장의 카드로 이루어진 패.
+    HF_BLACKJACK = 0x08,  // 내추럴 블랙잭.
+    HF_BUST      = 0x10   // 카드 값의 총합이 21을 넘은 패.
+} HandFlag;
+
+/* 블랙잭 카드의 패를 나타내는 구조체. */
+typedef struct Hand {
+    Card cards[MAX_HAND_COUNT];  // 블랙잭 카드 배열.
+    uint8_t length;              // 패에 있는 카드 수.
+    uint8_t hardTotal;           // 에이스를 1로 계산한 카드 값의 총합.
+    uint8_t total;               // 카드 값의 총합.
+    uint8_t score;               // 게임 결과 판정에 사용되는 점수.
+    uint8_t flags;               // 패의 상태.
+} Hand;
+
+/*
+    블랙잭 카드 슈에 남아있는 카드의 구성을 나타내는 구조체.
+
+    카드의 랭크는 에이스 (0), 2 ~ 9 (1 ~ 8), 10점 카드 (9) 순서로 센다.
+*/
+typedef struct RankCounts {
+    uint16_t counts[RANK_COUNT];  // 랭크별 카드 수.
+    uint16_t total;               // 전체 카드 수.
+} RankCounts;
+
+/* 블랙잭 카드 슈를 나타내는 구조체. */
+typedef struct Shoe {
+    Card cards[MAX_SHOE_CARD_COUNT];  // 블랙잭 카드 배열.
+    int length;                       // 남아있는 카드 수.
+    int capacity;                     // 카드 슈에 들어가는 카드 수.
+    int cutCard;                      // 컷 카드가 나오는 시점의 남은 카드 수.
+    int shuffleCount;                 // 카드 슈를 섞은 횟수.
+    RankCounts counts;                // 남아있는 카드의 구성.
+} Shoe;
+
+/* 딜러 패의 최종 결과를 나타내는 열거형. */
+typedef enum DealerOutcome {
+    DO_17,         // 17로 끝난 패.
+    DO_18,         // 18로 끝난 패.
+    DO_19,         // 19로 끝난 패.
+    DO_20,         // 20으로 끝난 패.
+    DO_21,         // 21로 끝난 패.
+    DO_BUST,       // 버스트된 패.
+    DO_BLACKJACK,  // 내추럴 블랙잭.
+    _DO_COUNT
+} DealerOutcome;
+
+/* 딜러 패의 최종 결과에 대한 확률 분포를 나타내는 구조체. */
+typedef struct DealerDistribution {
+    double p[_DO_COUNT];  // 결과별 확률.
+} DealerDistribution;
+
+/* 딜러 패의 확률 분포 캐시 항목을 나타내는 구조체. */
+typedef struct DealerCacheEntry {
+    RankCounts counts;                // 카드 슈의 구성.
+    uint8_t upcard;                   // 딜러의 첫 번째 카드의 랭크.
+    uint8_t flags;                    // 캐시 항목의 상태.
+    DealerDistribution distribution;  // 딜러 패의 확률 분포.
+} DealerCacheEntry;
+
+/* 딜러 패의 확률 분포 캐시를 나타내는 구조체. */
+typedef struct DealerCache {
+    DealerCacheEntry entries[DEALER_CACHE_SIZE];  // 캐시 항목 배열.
+    uint64_t hits, misses;                        // 캐시 적중 및 실패 횟수.
+} DealerCache;
+
+/* 플레이어의 행동을 나타내는 열거형. */
+typedef enum PlayerAction {
+    PA_STAND,      // 카드를 그만 받는다.
+    PA_HIT,        // 카드를 한 장 더 받는다.
+    PA_DOUBLE,     // 베팅 금액을 두 배로 올리고, 카드를 한 장만 더 받는다.
+    PA_SPLIT,      // 값이 같은 두 장의 카드를 두 개의 패로 나눈다.
+    PA_SURRENDER,  // 베팅 금액의 절반을 돌려받고 게임을 포기한다.
+    PA_INSURANCE,  // 딜러의 블랙잭에 대비하여 인슈어런스를 건다.
+    _PA_COUNT
+} PlayerAction;
+
+/* 블랙잭 게임 전략 계산기의 캐시 항목을 나타내는 구조체. */
+typedef struct SolverCacheEntry {
+    RankCounts counts;  // 카드 슈의 구성.
+    uint8_t hardTotal;  // 에이스를 1로 계산한 플레이어 패의 합.
+    uint8_t upcard;     // 딜러의 첫 번째 카드의 랭크.
+    uint8_t flags;      // 캐시 항목의 상태.
+    double standEv;     // 카드를 그만 받을 때의 기댓값.
+    double hitEv;       // 카드를 받고 최선의 행동을 이어갈 때의 기댓값.
+} SolverCacheEntry;
+
+/* 블랙잭 게임 전략 계산기를 나타내는 구조체. */
+typedef struct Solver {
+    DealerCache dealerCache;                        // 딜러 패의 확률 분포 캐시.
+    SolverCacheEntry entries[SOLVER_CACHE_SIZE];    // 캐시 항목 배열.
+    uint64_t hits, misses;                          // 캐시 적중 및 실패 횟수.
+} Solver;
+
+/* 블랙잭 게임 전략 계산기의 계산 결과를 나타내는 구조체. */
+typedef struct SolverResult {
+    double ev[_PA_COUNT];  // 행동별 기댓값.
+    uint8_t available;     // 선택 가능한 행동의 비트마스크.
+    PlayerAction best;     // 기댓값이 가장 높은 행동.
+} SolverResult;
+
+/* 여러 개의 패를 한 번에 계산할 때 사용하는 연산 방식을 나타내는 열거형. */
+typedef enum BatchKernel {
+    BK_AUTO,    // 사용 가능한 가장 빠른 연산 방식.
+    BK_SCALAR,  // 일반 연산.
+    BK_SSE2,    // SSE2 명령어 집합을 이용한 연산.
+    BK_AVX2     // AVX2 명령어 집합을 이용한 연산.
+} BatchKernel;
+
+/*
+    여러 개의 패를 구조체 배열 (SoA) 형태로 나타내는 구조체.
+
+    `counts[r][i]`는 `i + 1`번째 패에 있는 랭크 `r`의 카드 수이다.
+*/
+typedef struct HandBatch {
+    const uint8_t *counts[RANK_COUNT];  // 랭크별 카드 수 배열.
+    int length;                         // 패의 개수.
+} HandBatch;
+
+/* 여러 개의 패에 대한 계산 결과를 나타내는 구조체. */
+typedef struct HandBatchResult {
+    uint8_t *totals;  // 패별 카드 값의 총합.
+    uint8_t *flags;   // 패별 상태 (`HF_ACE`, `HF_SOFT`, `HF_BLACKJACK`, `HF_BUST`).
+} HandBatchResult;
+
+/* 카드 카운팅 방식을 나타내는 열거형. */
+typedef enum CountSystem {
+    CT_HI_LO,     // Hi-Lo 방식.
+    CT_KO,        // KO (Knock-Out) 방식.
+    CT_OMEGA_II,  // Omega II 방식.
+    _CT_COUNT
+} CountSystem;
+
+/* 공개된 카드로 계산한 카드 카운팅 상태를 나타내는 구조체. */
+typedef struct CardCount {
+    int running[_CT_COUNT];  // 카드 카운팅 방식별 러닝 카운트.
+} CardCount;
+
+/* 블랙잭 승리 시의 배당을 나타내는 열거형. */
+typedef enum BlackjackPayout {
+    BP_3_TO_2,  // 3:2 배당.
+    BP_6_TO_5,  // 6:5 배당.
+    _BP_COUNT
+} BlackjackPayout;
+
+/* 고정된 범위를 같은 간격으로 나눈 히스토그램을 나타내는 구조체. */
+typedef struct Histogram {
+    double min, max;                       // 히스토그램의 범위.
+    int64_t counts[HISTOGRAM_BIN_COUNT];   // 구간별 값의 개수.
+    int64_t underflow, overflow;           // 범위를 벗어난 값의 개수.
+    int64_t total;                         // 전체 값의 개수.
+} Histogram;
+
+/*
+    음이 아닌 값의 분위수를 상대 오차 안에서 추정하는 스케치를 나타내는 구조체.
+
+    값을 로그 간격의 구간에 나눠 세므로, 값의 개수와 관계없이 메모리 사용량이
+    일정하다.
+*/
+typedef struct QuantileSketch {
+    int64_t buckets[SKETCH_BUCKET_COUNT];  // 구간별 값의 개수.
+    int64_t zeroCount;                     // `SKETCH_MIN_VALUE` 이하인 값의 개수.
+    int64_t count;                         // 전체 값의 개수.
+    double sum;                            // 전체 값의 합.
+    double max;                            // 가장 큰 값.
+} QuantileSketch;
+
+/* 블랙잭 게임의 규칙을 나타내는 구조체. */
+typedef struct Rules {
+    int deckCount;                    // 카드 슈에 들어가는 덱의 수. (연속 셔플 기계는 늘어날 수 있음, `GetTableDeckCount()` 참고)
+    float penetration;                // 카드 슈를 다시 섞기 전까지 사용하는 카드의 비율.
+    int seatCount;                    // 블랙잭 테이블의 좌석 수.
+    int splitHandCount;               // 카드를 나눠서 만들 수 있는 최대 패의 수.
+    bool doubleAfterSplit;            // 카드를 나눈 뒤에 더블 다운이 가능한지 여부.
+    bool surrender;                   // 서렌더가 가능한지 여부.
+    bool dealerHitsSoft17;            // 딜러가 소프트 17에서 카드를 받는지 여부.
+    BlackjackPayout blackjackPayout;  // 블랙잭 승리 시의 배당.
+    bool continuousShuffle;           // 연속 셔플 기계를 사용하는지 여부.
+} Rules;
+
+/*
+    블랙잭 게임의 기본 전략표.
+
+    행은 하드 5 ~ 20, 소프트 13 ~ 20, 2 ~ 10과 에이스 페어 순서이고,
+    열은 딜러의 첫 번째 카드가 2 ~ 10, 에이스인 순서이다.
+*/
+typedef struct StrategyChart {
+    Rules rules;                                           // 전략표를 계산한 규칙.
+    uint8_t actions[CHART_ROW_COUNT][CHART_COLUMN_COUNT];  // 칸별로 가장 좋은 행동.
+    float evs[CHART_ROW_COUNT][CHART_COLUMN_COUNT];        // 칸별로 가장 좋은 행동의 기댓값.
+} StrategyChart;
+
+/* 블랙잭 테이블의 좌석에 앉는 봇 플레이어의 종류를 나타내는 열거형. */
+typedef enum BotType {
+    BT_BASIC_STRATEGY,   // 기본 전략표대로 행동한다.
+    BT_COUNT_DEVIATION,  // Hi-Lo 트루 카운트에 따라 기본 전략표를 바꿔서 행동한다.
+    BT_ALWAYS_HIT,       // 21이 될 때까지 카드를 받는다.
+    BT_NEVER_BUST,       // 버스트될 수 있는 패로는 카드를 받지 않는다.
+    _BT_COUNT
+} BotType;
+
+/*
+    봇 플레이어의 행동 규칙.
+
+    모든 결정은 트루 카운트 구간, 행 (패의 상태), 열 (딜러의 첫 번째 카드)과
+    선택할 수 있는 행동의 비트마스크로 찾는 표에 미리 계산해 둔다. 행은
+    기본 전략표의 행 뒤에 무조건 스탠드하는 행과 인슈어런스 행이 이어진다.
+*/
+typedef struct BotPolicy {
+    BotType type;                                                  // 봇 플레이어의 종류.
+    uint8_t rows[4][BOT_TOTAL_COUNT];                              // 소프트, 페어 여부와 패의 합에 따른 행 번호.
+    int8_t minCounts[BOT_ROW_COUNT][CHART_COLUMN_COUNT];           // 트루 카운트가 이보다 작으면 낮은 구간을 사용한다.
+    int8_t maxCounts[BOT_ROW_COUNT][CHART_COLUMN_COUNT];           // 트루 카운트가 이 이상이면 높은 구간을 사용한다.
+    uint8_t actions[BOT_BUCKET_COUNT][BOT_ROW_COUNT][CHART_COLUMN_COUNT][BOT_ACTION_MASK_COUNT];  // 구간별 행동표.
+} BotPolicy;
+
+/* 블랙잭 게임의 상태를 나타내는 열거형. */
+typedef enum GameState {
+    GS_INIT,         // 초기 상태.
+    GS_INSURANCE,    // 플레이어가 인슈어런스를 결정하는 상태.
+    GS_PLAYER_TURN,  // 플레이어 차례.
+    GS_DEALER_TURN,  // 딜러의 차례.
+    GS_ROUND_END     // 게임 종료 상태.
+} GameState;
+
+/* 블랙잭 게임의 결과를 나타내는 열거형. */
+typedef enum RoundResult {
+    RR_NONE,              // 결과 없음.
+    RR_PLAYER_WIN,        // 플레이어의 승리.
+    RR_DEALER_WIN,        // 딜러의 승리.
+    RR_PUSH,              // 무승부.
+    RR_PLAYER_BLACKJACK,  // 플레이어의 블랙잭 승리.
+    RR_SURRENDER,         // 플레이어의 서렌더.
+    _RR_COUNT
+} RoundResult;
+
+/* 난수 생성기의 상태를 나타내는 구조체. */
+typedef struct RandomState {
+    uint64_t s[4];  // xoshiro256** 생성기의 상태.
+} RandomState;
+
+/* 플레이어 패의 베팅 상태를 나타내는 열거형. */
+typedef enum PlayerHandFlag {
+    PH_SPLIT       = 0x01,  // 카드를 나눠서 만든 패.
+    PH_DOUBLED     = 0x02,  // 더블 다운을 한 패.
+    PH_SURRENDERED = 0x04   // 서렌더를 한 패.
+} PlayerHandFlag;
+
+/* 블랙잭 게임의 규칙 조합에 맞게 특수화된 게임 진행 함수들의 구조체. */
+typedef struct TableVariant TableVariant;
+
+/*
+    블랙잭 테이블의 상태를 나타내는 구조체.
+
+    좌석별 상태는 좌석 번호를 첫 번째 인덱스로 하는 배열에 모아 두며,
+    0번 좌석은 딜러의 왼쪽에서 가장 먼저 카드를 받는 좌석이다.
+*/
+typedef struct Table {
+    Rules rules;                                                    // 블랙잭 게임의 규칙.
+    const TableVariant *variant;                                    // 규칙에 맞게 특수화된 게임 진행 함수.
+    Shoe shoe;                                                      // 블랙잭 카드 슈.
+    Hand dealerHand;                                                // 딜러의 패.
+    Hand playerHands[MAX_SEAT_COUNT][MAX_SPLIT_HAND_COUNT];         // 좌석별 플레이어의 패.
+    uint8_t playerHandFlags[MAX_SEAT_COUNT][MAX_SPLIT_HAND_COUNT];  // 좌석별 플레이어 패의 베팅 상태.
+    RoundResult results[MAX_SEAT_COUNT][MAX_SPLIT_HAND_COUNT];      // 좌석별 플레이어 패의 게임 결과.
+    uint8_t playerHandCounts[MAX_SEAT_COUNT];                       // 좌석별 플레이어 패의 개수.
+    bool insured[MAX_SEAT_COUNT];                                   // 좌석별 인슈어런스 여부.
+    double payouts[MAX_SEAT_COUNT];                                 // 좌석별 베팅 금액 1에 대한 손익.
+    int activeSeat;                                                 // 차례인 좌석의 번호.
+    int activeHand;                                                 // 차례인 좌석에서 진행 중인 패의 번호.
+    GameState state;                                                // 블랙잭 게임의 상태.
+    RoundResult result;                                             // 0번 좌석의 첫 번째 패에 대한 게임의 결과.
+    double payout;                                                  // 모든 좌석의 손익의 합.
+    RandomState random;                                             // 블랙잭 테이블 전용 난수 생성기.
+    CardCount count;                                                // 공개된 카드의 카드 카운팅 상태.
+} Table;
+
+/* 블랙잭 테이블에서 플레이어의 행동을 정하는 함수. */
+typedef PlayerAction (*PlayerPolicy)(const Table *table, void *userData);
+
+/*
+    리플레이 기록의 행동 외 이벤트를 나타내는 열거형.
+
+    리플레이 기록은 헤더 뒤에 이벤트가 한 바이트씩 이어지는 형태이며,
+    `PlayerAction` 값은 그대로 행동 이벤트로 사용한다. `RE_OUTCOME` 뒤에는
+    모든 좌석의 베팅 금액 1에 대한 손익의 합에 `REPLAY_PAYOUT_SCALE`을
+    곱한 16비트 정수가 리틀 엔디언으로 이어진다.
+*/
+typedef enum ReplayEvent {
+    RE_OUTCOME = 0xFE,  // 게임 결과.
+    RE_RESET   = 0xFF   // 블랙잭 테이블 초기화.
+} ReplayEvent;
+
+/* 리플레이 기록을 파일에 저장하는 기록기를 나타내는 구조체. */
+typedef struct ReplayWriter {
+    FILE *file;  // 리플레이 기록 파일.
+} ReplayWriter;
+
+/* 리플레이 기록을 다시 실행한 결과를 나타내는 구조체. */
+typedef struct ReplayStats {
+    int64_t roundCount;     // 결과가 기록된 게임의 수.
+    int64_t actionCount;    // 실행한 행동의 수.
+    int64_t mismatchCount;  // 기록과 다른 결과가 나온 횟수.
+    int64_t firstMismatch;  // 처음으로 기록과 달라진 이벤트의 위치 (없으면 -1).
+    double payout;          // 기록된 손익의 합.
+    double replayedPayout;  // 다시 실행한 손익의 합.
+} ReplayStats;
+
+/*
+    테이블 호스트에서 블랙잭 테이블을 가리키는 번호.
+
+    하위 `HOST_INDEX_BITS`비트는 블록의 번호이고, 나머지 비트는 블록을
+    다시 사용할 때마다 바뀌는 32비트 세대 번호이다.
+*/
+typedef uint64_t TableId;
+
+struct TableHost;
+
+/* 테이블 호스트의 블랙잭 테이블에서 게임이 끝날 때마다 호출되는 함수. */
+typedef void (*HostRoundCallback)(
+    struct TableHost *host,
+    TableId id,
+    const Table *table,
+    void *userData
+);
+
+/*
+    테이블 호스트가 관리하는 고정된 크기의 블랙잭 테이블 블록.
+
+    이벤트는 리플레이 기록과 같은 형식으로, `PlayerAction` 값이나
+    `RE_RESET`이다.
+*/
+typedef struct HostedTable {
+    Table table;                                 // 블랙잭 테이블.
+    const BotPolicy *bots[MAX_SEAT_COUNT];       // 좌석별로 앉은 봇 플레이어.
+    uint8_t events[HOST_EVENT_QUEUE_SIZE];       // 처리할 이벤트의 원형 큐.
+    uint8_t eventHead, eventCount;               // 원형 큐의 시작 위치와 이벤트의 개수.
+    uint32_t generation;                         // 블록을 다시 사용한 횟수.
+    bool used;                                   // 블록을 사용 중인지 여부.
+    bool ready;                                  // 처리할 테이블 목록에 들어 있는지 여부.
+    int32_t nextFree, nextReady;                 // 빈 블록 목록과 처리할 테이블 목록의 다음 블록.
+} HostedTable;
+
+/* 한 프로세스에서 여러 개의 블랙잭 테이블을 진행하는 테이블 호스트. */
+typedef struct TableHost {
+    HostedTable **slabs;           // `HOST_SLAB_TABLE_COUNT`개씩 할당한 블록 배열의 배열.
+    int slabCount, slabCapacity;   // 할당한 슬랩의 수와 슬랩 배열의 크기.
+    int32_t freeHead;              // 빈 블록 목록의 첫 번째 블록.
+    int32_t readyHead, readyTail;  // 처리할 테이블 목록의 처음과 끝 블록.
+    int tableCount;                // 사용 중인 블랙잭 테이블의 수.
+    RandomState random;            // 블랙잭 테이블의 시드 값을 정하는 난수 생성기.
+    HostRoundCallback onRoundEnd;  // 게임이 끝날 때마다 호출되는 함수.
+    void *userData;                // `onRoundEnd`에 넘길 데이터.
+} TableHost;
+
+/* | `engine` 모듈 함수... | */
+
+/* 블랙잭 게임의 기본 규칙을 반환한다. */
+Rules GetDefaultRules(void);
+
+/* 블랙잭 게임의 규칙에 따른 블랙잭 승리 시의 배당을 반환한다. */
+double GetBlackjackPayout(const Rules *rules);
+
+/*
+    블랙잭 게임의 규칙으로 만든 블랙잭 테이블이 실제로 사용하는 덱의 수를
+    반환한다.
+
+    연속 셔플 기계는 게임 도중에 비면 안 되므로, 모든 좌석의 모든 패가
+    가질 수 있는 카드보다 많은 카드가 들어가도록 덱의 수를 늘린다.
+    (예: 7개의 좌석에서 4개의 패까지 나눌 수 있으면 최소 3덱)
+*/
+int GetTableDeckCount(const Rules *rules);
+
+/*
+    주어진 규칙과 시드 값으로 블랙잭 테이블을 생성한다.
+
+    `rules`가 `NULL`이면 기본 규칙을 사용한다. 같은 시드 값을 사용하는
+    테이블들도 `stream` 값이 다르면 서로 겹치지 않는 난수열을 사용한다.
+    게임 진행 함수는 이 때 규칙에 맞게 특수화된 것으로 한 번만 고른다.
+*/
+void InitTable(Table *table, const Rules *rules, uint64_t seed, int stream);
+
+/*
+    블랙잭 테이블을 초기화한다.
+
+    카드 슈는 컷 카드가 나온 경우에만 다시 섞는다.
+*/
+void ResetTable(Table *table);
+
+/* 블랙잭 테이블의 카드 슈를 생성하고 섞는다. */
+void GenerateTableShoe(Table *table);
+
+/* 블랙잭 테이블의 카드 슈에서 컷 카드가 나왔는지 확인한다. */
+bool IsTableShoeCut(const Table *table);
+
+/*
+    블랙잭 테이블의 덱에서 카드를 한 장 뽑는다.
+
+    플레이어에게 주는 카드는 차례인 좌석에서 진행 중인 패에 추가된다.
+*/
+bool DealTableCard(Table *table, bool toPlayer);
+
+/* 블랙잭 테이블에서 지금 선택할 수 있는 행동의 비트마스크를 반환한다. */
+uint8_t GetTableActions(const Table *table);
+
+/*
+    플레이어의 행동에 따라 블랙잭 테이블의 게임 상태를 변경한다.
+
+    `GS_INIT` 상태에서는 행동과 관계없이 모든 좌석에 카드를 나눠주고,
+    `GS_INSURANCE` 상태에서는 `PA_INSURANCE` 외의 행동을 인슈어런스 거절로
+    처리하며, 블랙잭인 좌석은 인슈어런스를 묻지 않고 건너뛴다. 행동은 차례인 좌석에 적용되며, 선택할 수 없는 행동이면 아무
+    것도 하지 않고 `false`를 반환한다.
+*/
+bool TakeTableTurn(Table *table, PlayerAction action);
+
+/* 블랙잭 카드의 값을 반환한다. */
+int GetCardValue(Card card);
+
+/* 블랙잭 카드의 랭크를 반환한다. */
+int GetCardRank(Card card);
+
+/* 블랙잭 카드 슈에 남아있는 카드의 구성을 반환한다. */
+void GetShoeRankCounts(const Shoe *shoe, RankCounts *counts);
+
+/* 주어진 카드 구성에서 다음 카드의 랭크가 `rank`일 확률을 반환한다. */
+double GetRankProbability(const RankCounts *counts, int rank);
+
+/* 주어진 카드 구성에서 카드를 한 장 더 받았을 때 패가 버스트될 확률을 반환한다. */
+double GetBustProbability(const RankCounts *counts, const Hand *hand);
+
+/* 블랙잭 카드 슈의 구성에 대한 해시 값을 계산한다. */
+uint64_t HashRankCounts(const RankCounts *counts);
+
+/* 블랙잭 카드의 패를 비운다. */
+void ClearHand(Hand *hand);
+
+/* 블랙잭 카드의 패에 카드를 한 장 추가하고, 패의 상태를 갱신한다. */
+bool AddHandCard(Hand *hand, Card card);
+
+/* 플레이어와 딜러의 패를 비교하여 게임의 결과를 반환한다. */
+RoundResult GetRoundResult(const Hand *playerHand, const Hand *dealerHand);
+
+/*
+    블랙잭 테이블에서 게임을 한 판 진행하고, 그 결과를 반환한다.
+
+    플레이어는 패의 합이 `standTotal` 이상이 될 때까지 카드를 받는다.
+*/
+RoundResult PlayTableRound(Table *table, int standTotal);
+
+/*
+    블랙잭 테이블에서 `policy`가 정하는 행동으로 게임을 한 판 진행하고,
+    베팅 금액 1에 대한 플레이어의 손익을 반환한다.
+
+    `policy`가 선택할 수 없는 행동을 반환하면 카드를 그만 받는다.
+*/
+double PlayTablePolicyRound(Table *table, PlayerPolicy policy, void *userData);
+
+/* | `csm` 모듈 함수... | */
+
+/*
+    연속 셔플 기계의 배출구에서 카드를 한 장 꺼내고, 기계 안의 카드 중
+    하나를 무작위로 골라 배출구의 빈 자리를 채운다.
+*/
+Card TakeCsmCard(Shoe *shoe, RandomState *rs);
+
+/*
+    사용한 카드를 연속 셔플 기계에 다시 넣는다.
+
+    연속 셔플 기계가 가득 차 있으면 `false`를 반환한다.
+*/
+bool ReturnCsmCard(Shoe *shoe, Card card);
+
+/* | `count` 모듈 함수... | */
+
+/* 카드 카운팅 상태를 초기화한다. */
+void ResetCardCount(CardCount *count, int deckCount);
+
+/* 공개된 카드 한 장으로 모든 카드 카운팅 방식의 러닝 카운트를 갱신한다. */
+void UpdateCardCount(CardCount *count, Card card);
+
+/* 주어진 카드 카운팅 방식의 러닝 카운트를 반환한다. */
+int GetRunningCount(const CardCount *count, CountSystem system);
+
+/*
+    주어진 카드 카운팅 방식의 러닝 카운트를 남은 덱의 수로 나눈
+    트루 카운트를 반환한다.
+*/
+double GetTrueCount(const CardCount *count, CountSystem system, int remainingCards);
+
+/* | `dealer` 모듈 함수... | */
+
+/* 딜러 패의 확률 분포 캐시를 초기화한다. */
+void InitDealerCache(DealerCache *cache);
+
+/*
+    카드 슈의 구성과 딜러의 첫 번째 카드에 대한 딜러 패의 최종 결과의 확률
+    분포를 계산한다.
+
+    `counts`에는 딜러의 첫 번째 카드가 빠진 상태의 구성을 넘겨야 한다.
+    `peek`이 `true`이면 딜러가 블랙잭이 아닌 경우에 대한 조건부 확률을
+    계산한다. `hitsSoft17`이 `true`이면 딜러는 소프트 17에서도 카드를 받는다.
+    `cache`가 `NULL`이 아니면 계산 결과를 캐시에 저장하고, 같은 구성에
+    대해서는 저장된 결과를 사용한다.
+*/
+void GetDealerDistribution(
+    DealerCache *cache,
+    const RankCounts *counts,
+    int upcard,
+    bool peek,
+    bool hitsSoft17,
+    DealerDistribution *result
+);
+
+/* | `solver` 모듈 함수... | */
+
+/* 블랙잭 게임 전략 계산기를 초기화한다. */
+void InitSolver(Solver *solver);
+
+/*
+    플레이어의 패, 딜러의 첫 번째 카드와 카드 슈의 구성에 대해 각 행동의
+    기댓값을 계산하고, 기댓값이 가장 높은 행동을 찾는다.
+
+    `counts`에는 플레이어의 패와 딜러의 첫 번째 카드가 빠진 상태의 구성을
+    넘겨야 한다. 딜러가 블랙잭이 아닌 경우에 대한 조건부 기댓값을 계산하며,
+    딜러가 소프트 17에서 카드를 받는지와 블랙잭 배당은 `rules`를 따른다.
+
+    `result->available`에는 `rules`가 허용하는 행동만 들어가지만, 좌석의
+    상태는 알지 못하므로 `hand`를 나누지 않은 첫 번째 패로 보고 계산한다.
+    나눈 패에 대해서는 `GetTableActions()`로 행동을 한 번 더 걸러야 한다.
+    카드를 나눌 때의 기댓값은 나눈 두 패를 서로 독립적으로 보고, 나눈 패를
+    다시 나누는 경우는 계산하지 않는 근사값이다.
+*/
+void SolveHand(
+    Solver *solver,
+    const Rules *rules,
+    const Hand *hand,
+    int upcard,
+    const RankCounts *counts,
+    SolverResult *result
+);
+
+/* | `chart` 모듈 함수... | */
+
+/*
+    여러 규칙에 대한 기본 전략표를 `threadCount`개의 스레드로 한 번에 계산한다.
+
+    각 전략표의 `rules`는 미리 채워 두어야 한다. 칸마다 계산량이 크게
+    다르므로, 일이 먼저 끝난 스레드는 다른 스레드에 남은 칸을 가져온다.
+*/
+bool GenerateStrategyCharts(StrategyChart *charts, int chartCount, int threadCount);
+
+/* 기본 전략표들을 바이너리 파일로 저장한다. */
+bool SaveStrategyCharts(const char *path, const StrategyChart *charts, int chartCount);
+
+/*
+    바이너리 파일에서 기본 전략표들을 불러오고, 불러온 전략표의 수를 반환한다.
+
+    파일이 올바르지 않으면 -1을 반환한다.
+*/
+int LoadStrategyCharts(const char *path, StrategyChart *charts, int maxCount);
+
+/* 기본 전략표들을 사람이 읽을 수 있는 CSV 파일로 저장한다. */
+bool ExportStrategyChartsCsv(const char *path, const StrategyChart *charts, int chartCount);
+
+/*
+    덱의 수, 소프트 17, 스플릿 후 더블다운과 서렌더 규칙이 `rules`와 같은
+    기본 전략표를 찾는다. 같은 전략표가 없으면 `NULL`을 반환한다.
+*/
+const StrategyChart *FindStrategyChart(
+    const StrategyChart *charts,
+    int chartCount,
+    const Rules *rules
+);
+
+/* | `bot` 모듈 함수... | */
+
+/*
+    주어진 종류의 봇 플레이어의 행동표를 만든다.
+
+    `BT_BASIC_STRATEGY`와 `BT_COUNT_DEVIATION`은 `chart`의 행동을 따르고,
+    나머지는 `chart`를 사용하지 않는다. 가장 좋은 행동을 선택할 수 없을 때의
+    대안도 행동표에 함께 기록한다.
+*/
+bool InitBotPolicy(BotPolicy *bot, BotType type, const StrategyChart *chart);
+
+/*
+    블랙잭 테이블에서 차례인 좌석의 봇 플레이어가 할 행동을 반환한다.
+
+    `PlayerPolicy`로 사용할 수 있으며, `userData`에는 `BotPolicy`를 넘긴다.
+*/
+PlayerAction GetBotAction(const Table *table, void *userData);
+
+/*
+    블랙잭 테이블에서 차례인 좌석에 앉은 봇 플레이어가 할 행동을 반환한다.
+
+    `PlayerPolicy`로 사용할 수 있으며, `userData`에는 좌석 번호로 찾는
+    `const BotPolicy *` 배열을 넘긴다.
+*/
+PlayerAction GetSeatBotAction(const Table *table, void *userData);
+
+/* | `batch` 모듈 함수... | */
+
+/* 현재 CPU에서 사용 가능한 가장 빠른 연산 방식을 반환한다. */
+BatchKernel GetBestBatchKernel(void);
+
+/*
+    여러 개의 패에 대해 카드 값의 총합과 소프트, 버스트, 블랙잭 여부를
+    한 번에 계산한다.
+
+    현재 CPU에서 사용할 수 없는 연산 방식을 지정하면, 사용 가능한 가장
+    빠른 연산 방식을 대신 사용한다.
+*/
+void EvaluateHandBatch(
+    const HandBatch *batch,
+    HandBatchResult *result,
+    BatchKernel kernel
+);
+
+/* | `stats` 모듈 함수... | */
+
+/* 주어진 범위로 히스토그램을 초기화한다. */
+void InitHistogram(Histogram *histogram, double min, double max);
+
+/* 히스토그램에 값을 추가한다. */
+void AddHistogramValue(Histogram *histogram, double value);
+
+/* 범위가 같은 히스토그램 `src`의 값들을 `dst`에 합친다. */
+void MergeHistogram(Histogram *dst, const Histogram *src);
+
+/* 히스토그램에서 `q` (0 ~ 1) 분위수가 속한 구간의 중앙값을 반환한다. */
+double GetHistogramQuantile(const Histogram *histogram, double q);
+
+/* 분위수 스케치를 초기화한다. */
+void InitQuantileSketch(QuantileSketch *sketch);
+
+/* 분위수 스케치에 음이 아닌 값을 추가한다. */
+void AddSketchValue(QuantileSketch *sketch, double value);
+
+/* 분위수 스케치 `src`의 값들을 `dst`에 합친다. */
+void MergeQuantileSketch(QuantileSketch *dst, const QuantileSketch *src);
+
+/* 분위수 스케치에서 `q` (0 ~ 1) 분위수의 추정값을 반환한다. */
+double GetSketchQuantile(const QuantileSketch *sketch, double q);
+
+/* | `replay` 모듈 함수... | */
+
+/*
+    리플레이 기록 파일을 만들고, 블랙잭 테이블의 시드 값과 규칙을 기록한다.
+
+    `table`은 `seed`와 `stream`으로 방금 생성한 테이블이어야 하며,
+    `stream`은 0 이상 `MAX_REPLAY_STREAM` 미만이어야 한다.
+*/
+bool OpenReplayWriter(
+    ReplayWriter *writer,
+    const char *path,
+    const Table *table,
+    uint64_t seed,
+    int stream
+);
+
+/* 리플레이 기록 파일을 닫는다. */
+void CloseReplayWriter(ReplayWriter *writer);
+
+/* 리플레이 기록에 플레이어의 행동이나 블랙잭 테이블 초기화를 기록한다. */
+void WriteReplayEvent(ReplayWriter *writer, uint8_t event);
+
+/* 리플레이 기록에 블랙잭 테이블의 게임 결과를 기록한다. */
+void WriteReplayOutcome(ReplayWriter *writer, const Table *table);
+
+/*
+    메모리에 불러온 리플레이 기록을 화면에 그리지 않고 다시 실행하여,
+    기록된 결과와 비교한다.
+
+    `rules`가 `NULL`이 아니면 기록된 규칙 대신 `rules`로 다시 실행한다.
+    리플레이 기록의 헤더가 올바르지 않거나, 헤더의 규칙이나 난수열 번호가
+    엔진이 지원하는 범위를 벗어나면 `false`를 반환한다.
+*/
+bool RunReplay(
+    const uint8_t *data,
+    size_t length,
+    const Rules *rules,
+    ReplayStats *stats
+);
+
+/* | `host` 모듈 함수... | */
+
+/* 테이블 호스트를 초기화한다. */
+void InitTableHost(
+    TableHost *host,
+    uint64_t seed,
+    HostRoundCallback onRoundEnd,
+    void *userData
+);
+
+/* 테이블 호스트에 할당된 메모리를 해제한다. */
+void FreeTableHost(TableHost *host);
+
+/*
+    테이블 호스트에 블랙잭 테이블을 하나 열고, 테이블의 번호를 반환한다.
+
+    `bots`가 `NULL`이 아니면 좌석별로 봇 플레이어를 앉히며, `NULL`인
+    좌석은 이벤트로 행동을 받는다. 테이블을 열 수 없으면
+    `HOST_INVALID_TABLE`을 반환한다.
+*/
+TableId OpenHostTable(TableHost *host, const Rules *rules, const BotPolicy *const *bots);
+
+/* 테이블 호스트의 블랙잭 테이블을 닫는다. */
+void CloseHostTable(TableHost *host, TableId id);
+
+/* 테이블 호스트의 블랙잭 테이블을 반환한다. 닫힌 테이블이면 `NULL`을 반환한다. */
+const Table *GetHostTable(const TableHost *host, TableId id);
+
+/*
+    테이블 호스트의 블랙잭 테이블에 이벤트를 하나 보낸다.
+
+    닫힌 테이블이거나 테이블의 이벤트 큐가 가득 찼으면 `false`를 반환한다.
+*/
+bool PostHostEvent(TableHost *host, TableId id, uint8_t event);
+
+/*
+    처리할 이벤트가 있거나 봇 플레이어의 차례인 블랙잭 테이블들을
+    돌아가며 최대 `maxEvents`개의 이벤트를 처리하고, 처리한 이벤트의 수를
+    반환한다.
+*/
+int RunTableHost(TableHost *host, int maxEvents);
+
+/* | `random` 모듈 함수... | */
+
+/* 주어진 시드 값으로 난수 생성기를 초기화한다. */
+void InitRandomState(RandomState *rs, uint64_t seed);
+
+/* 난수 생성기의 상태를 2^128번 앞으로 이동시킨다. */
+void JumpRandomState(RandomState *rs);
+
+/* 64비트 난수를 생성한다. */
+uint64_t GetNextRandom(RandomState *rs);
+
+/* `[0, bound)` 범위의 편향되지 않은 난수를 생성한다. */
+uint32_t GetBoundedRandom(RandomState *rs, uint32_t bound);
+
+#endif
\ No newline at end of file
@@ -27,6 +27,8 @@
 
 #include "raylib.h"
 
+#include "b021-engine.h"
+
 /* | 매크로 정의... | */
 
 #define GAME_NAME         "jdeokkim/b021"
@@ -34,17 +36,28 @@
 
 #define TARGET_FPS        60
 
+#define IDLE_WAIT_TIME    (1000.0f / TARGET_FPS)
+#define IDLE_REDRAW_TIME  1.0
+
+#define PROFILER_FRAME_COUNT  240
+
+#define TABLE_SEAT_COUNT  1
+#define TABLE_PLAYER_SEAT 0
+
+#define MAX_CHART_COUNT   64
+
+#define REPLAY_FILE_NAME  "b021.replay"
+#define CHART_FILE_NAME   "b021-chart.bin"
+
 #define SCREEN_WIDTH      640
 #define SCREEN_HEIGHT     480
 
-#define BLACKJACK         21
-
 #define CARD_WIDTH        64.0f
 #define CARD_HEIGHT       64.0f
 
-#define MAX_CARD_NUMBER   13
-#define MAX_CARD_COUNT    52
-#define MAX_HAND_COUNT    11
+#define MAX_BATCH_CARD_COUNT  (MAX_SEAT_COUNT * MAX_SPLIT_HAND_COUNT * MAX_HAND_COUNT)
+
+#define MAX_LABEL_LENGTH      64
 
 /* | 자료형 정의... | */
 
@@ -63,6 +76,46 @@ typedef enum SceneType {
     ST_GAME      // 게임 화면
 } SceneType;
 
+/* 블랙잭 카드의 화면 표시 상태를 나타내는 열거형. */
+typedef enum CardState {
+    CS_FRONT_NORMAL,  // 앞면 기본 상태.
+    CS_FRONT_HOVER,   // 앞면 마우스 접촉 상태.
+    CS_BACK_NORMAL,   // 뒷면 기본 상태.
+    CS_BACK_HOVER     // 뒷면 마우스 접촉 상태.
+} CardState;
+
+/* 한 번에 그릴 블랙잭 카드들의 사각형을 미리 계산해 둔 구조체. */
+typedef struct CardBatch {
+    bool dirty;                                  // 사각형을 다시 계산해야 하는지 여부.
+    int length;                                  // 카드의 수.
+    Rectangle sources[MAX_BATCH_CARD_COUNT];     // 카드 텍스처의 사각형. (정규화된 좌표)
+    Rectangle dests[MAX_BATCH_CARD_COUNT];       // 카드를 그릴 화면의 사각형.
+} CardBatch;
+
+/* 글리프 사각형들을 미리 배치해 둔 텍스트 레이블을 나타내는 구조체. */
+typedef struct TextLabel {
+    bool dirty;                              // 문자열을 다시 만들어야 하는지 여부.
+    Font font;                               // 글꼴.
+    float fontSize;                          // 글꼴의 크기.
+    float spacing;                           // 글자 사이의 간격.
+    char text[MAX_LABEL_LENGTH];             // 마지막으로 배치한 문자열.
+    Vector2 size;                            // 문자열의 크기.
+    int length;                              // 글리프 사각형의 수.
+    Rectangle sources[MAX_LABEL_LENGTH];     // 글꼴 텍스처의 사각형. (정규화된 좌표)
+    Rectangle dests[MAX_LABEL_LENGTH];       // 레이블의 위치에 대한 화면의 사각형.
+} TextLabel;
+
+/* 프로파일러가 시간을 재는 프레임 구간을 나타내는 열거형. */
+typedef enum ProfilePhase {
+    PP_MOUSE,   // 마우스 이벤트 처리
+    PP_BOARD,   // 블랙잭 보드와 카드 덱을 화면에 그리기
+    PP_DECK,    // 블랙잭 카드 덱을 렌더 텍스처에 다시 그리기
+    PP_HANDS,   // 딜러와 플레이어의 패 그리기
+    PP_FLUSH,   // 렌더 배치 비우기
+    PP_SWAP,    // 화면 버퍼 교체 및 프레임 대기
+    _PP_COUNT
+} ProfilePhase;
+
 /* 게임 리소스 데이터를 나타내는 구조체. */
 typedef struct Asset {
     bool loaded;            // 로딩 여부.
@@ -76,45 +129,6 @@ typedef struct Asset {
     } data;                 // 리소스 데이터.
 } Asset;
 
-/* 블랙잭 카드의 무늬를 나타내는 열거형. */
-typedef enum CardSuit {
-    SU_HEART,    // 하트 무늬.
-    SU_DIAMOND,  // 다이아몬드 무늬.
-    SU_CLOVER,   // 클로버 무늬.
-    SU_SPADE,    // 스페이드 무늬.
-    _SU_COUNT
-} CardSuit;
-
-/* 블랙잭 카드의 상태를 나타내는 구조체. */
-typedef enum CardState {
-    CS_FRONT_NORMAL,  // 앞면 기본 상태.
-    CS_FRONT_HOVER,   // 앞면 마우스 접촉 상태.
-    CS_BACK_NORMAL,   // 뒷면 기본 상태.
-    CS_BACK_HOVER     // 뒷면 마우스 접촉 상태.
-} CardState;
-
-/* 블랙잭 카드의 정보를 나타내는 구조체. */
-typedef struct Card {
-    CardSuit suit;    // 카드의 무늬.
-    CardState state;  // 카드의 상태.
-    int index;        // 카드의 인덱스.
-    float offset;     // 카드의 랜덤 값.
-} Card;
-
-/* 블랙잭 카드 덱을 나타내는 구조체. */
-typedef struct Deck {
-    Card cards[MAX_CARD_COUNT];  // 블랙잭 카드 배열.
-    int length;                  // 남아있는 카드 수.
-    int total;                   // 카드 값의 총합.
-} Deck;
-
-/* 블랙잭 게임의 상태를 나타내는 열거형. */
-typedef enum GameState {
-    GS_INIT,         // 초기 상태.
-    GS_PLAYER_TURN,  // 플레이어 차례.
-    GS_DEALER_TURN   // 딜러의 차례.
-} GameState;
-
 /* | `asset` 모듈 함수... | */
 
 /* `i + 1`번째 게임 리소스의 데이터를 메모리로 불러온다. */
@@ -140,6 +154,17 @@ void UpdateGameScene(void);
 /* 게임 플레이 장면을 종료한다. */
 int FinishGameScene(void);
 
+/* | `label` 모듈 함수... | */
+
+/* 텍스트 레이블을 초기화한다. */
+void InitTextLabel(TextLabel *label, Font font, float fontSize, float spacing);
+
+/* 텍스트 레이블의 문자열을 `text`로 변경한다. */
+void SetTextLabel(TextLabel *label, const char *text);
+
+/* 텍스트 레이블을 화면에 그린다. */
+void DrawTextLabel(const TextLabel *label, Vector2 position, Color tint);
+
 /* | `loader` 모듈 함수... | */
 
 /* 로딩 화면을 초기화한다. */
@@ -151,6 +176,23 @@ void UpdateLoadingScene(void);
 /* 로딩 화면을 종료한다. */
 int FinishLoadingScene(void);
 
+/* | `profiler` 모듈 함수... | */
+
+/* 프레임 하나의 시간 측정을 시작한다. */
+void BeginProfileFrame(void);
+
+/* 프레임 하나의 시간 측정을 마치고, 측정 결과를 기록한다. */
+void EndProfileFrame(void);
+
+/* 프레임 구간 `phase`의 시간 측정을 시작한다. */
+void BeginProfilePhase(ProfilePhase phase);
+
+/* 프레임 구간 `phase`의 시간 측정을 마친다. */
+void EndProfilePhase(ProfilePhase phase);
+
+/* 최근 프레임들의 구간별 시간과 프레임 시간 그래프를 그린다. */
+void DrawProfiler(Vector2 position);
+
 /* | `scene` 모듈 함수... | */
 
 /* 게임 장면을 변경한다. */
@@ -159,4 +201,7 @@ void LoadScene(SceneType st);
 /* 게임 화면을 업데이트한다. */
 void UpdateGame(void);
 
+/* 다음 프레임에 게임 화면을 다시 그리도록 요청한다. */
+void RequestRedraw(void);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,324 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define BATCH_USE_X86
+    #include <immintrin.h>
+#endif
+
+#include "b021-engine.h"
+
+/* | `batch` 모듈 매크로 정의... | */
+
+#define SOFT_HAND_BONUS    10
+#define MAX_SOFT_TOTAL     11
+
+/* | `batch` 모듈 함수... | */
+
+/* 일반 연산으로 `begin + 1`번째 패부터 `end`번째 패까지 계산한다. */
+static void EvaluateHandBatchScalar(
+    const HandBatch *batch,
+    HandBatchResult *result,
+    int begin,
+    int end
+);
+
+#ifdef BATCH_USE_X86
+
+/* SSE2 명령어 집합으로 16개 단위의 패를 계산하고, 계산한 패의 개수를 반환한다. */
+__attribute__((target("sse2")))
+static int EvaluateHandBatchSSE2(const HandBatch *batch, HandBatchResult *result);
+
+/* AVX2 명령어 집합으로 32개 단위의 패를 계산하고, 계산한 패의 개수를 반환한다. */
+__attribute__((target("avx2")))
+static int EvaluateHandBatchAVX2(const HandBatch *batch, HandBatchResult *result);
+
+#endif
+
+/* 현재 CPU에서 사용 가능한 가장 빠른 연산 방식을 반환한다. */
+BatchKernel GetBestBatchKernel(void) {
+#ifdef BATCH_USE_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) return BK_AVX2;
+    else if (__builtin_cpu_supports("sse2")) return BK_SSE2;
+#endif
+
+    return BK_SCALAR;
+}
+
+/*
+    여러 개의 패에 대해 카드 값의 총합과 소프트, 버스트, 블랙잭 여부를
+    한 번에 계산한다.
+*/
+void EvaluateHandBatch(
+    const HandBatch *batch,
+    HandBatchResult *result,
+    BatchKernel kernel
+) {
+    if (batch == NULL || result == NULL || batch->length <= 0) return;
+
+    BatchKernel bestKernel = GetBestBatchKernel();
+
+    if (kernel == BK_AUTO || kernel > bestKernel) kernel = bestKernel;
+
+    int begin = 0;
+
+#ifdef BATCH_USE_X86
+    if (kernel == BK_AVX2) begin = EvaluateHandBatchAVX2(batch, result);
+    else if (kernel == BK_SSE2) begin = EvaluateHandBatchSSE2(batch, result);
+#endif
+
+    // SIMD 연산으로 계산하지 못한 나머지 패를 계산한다.
+    EvaluateHandBatchScalar(batch, result, begin, batch->length);
+}
+
+/* 일반 연산으로 `begin + 1`번째 패부터 `end`번째 패까지 계산한다. */
+static void EvaluateHandBatchScalar(
+    const HandBatch *batch,
+    HandBatchResult *result,
+    int begin,
+    int end
+) {
+    for (int i = begin; i < end; i++) {
+        int hardTotal = 0, cardCount = 0;
+
+        for (int r = 0; r < RANK_COUNT; r++) {
+            hardTotal += (r + 1) * batch->counts[r][i];
+            cardCount += batch->counts[r][i];
+        }
+
+        bool hasAce = (batch->counts[0][i] > 0);
+        bool isSoft = hasAce && (hardTotal <= MAX_SOFT_TOTAL);
+
+        int total = hardTotal + (isSoft ? SOFT_HAND_BONUS : 0);
+
+        uint8_t flags = 0;
+
+        if (hasAce) flags |= HF_ACE;
+        if (isSoft) flags |= HF_SOFT;
+
+        if (hardTotal > BLACKJACK) flags |= HF_BUST;
+        else if (cardCount == 2 && total == BLACKJACK) flags |= HF_BLACKJACK;
+
+        result->totals[i] = (total > UINT8_MAX) ? UINT8_MAX : total;
+        result->flags[i] = flags;
+    }
+}
+
+#ifdef BATCH_USE_X86
+
+/* SSE2 명령어 집합으로 16비트 정수 8개에 해당하는 패를 계산한다. */
+__attribute__((target("sse2")))
+static inline void EvaluateHandLanesSSE2(
+    const __m128i *counts,
+    __m128i *totals,
+    __m128i *flags
+) {
+    const __m128i zero = _mm_setzero_si128();
+
+    __m128i hardTotal = zero, cardCount = zero;
+
+    for (int r = 0; r < RANK_COUNT; r++) {
+        hardTotal = _mm_add_epi16(
+            hardTotal,
+            _mm_mullo_epi16(counts[r], _mm_set1_epi16(r + 1))
+        );
+
+        cardCount = _mm_add_epi16(cardCount, counts[r]);
+    }
+
+    __m128i hasAce = _mm_cmpgt_epi16(counts[0], zero);
+
+    __m128i isSoft = _mm_and_si128(
+        hasAce,
+        _mm_cmplt_epi16(hardTotal, _mm_set1_epi16(MAX_SOFT_TOTAL + 1))
+    );
+
+    __m128i total = _mm_add_epi16(
+        hardTotal,
+        _mm_and_si128(isSoft, _mm_set1_epi16(SOFT_HAND_BONUS))
+    );
+
+    __m128i isBust = _mm_cmpgt_epi16(hardTotal, _mm_set1_epi16(BLACKJACK));
+
+    __m128i isBlackjack = _mm_and_si128(
+        _mm_cmpeq_epi16(cardCount, _mm_set1_epi16(2)),
+        _mm_cmpeq_epi16(total, _mm_set1_epi16(BLACKJACK))
+    );
+
+    __m128i result = _mm_and_si128(hasAce, _mm_set1_epi16(HF_ACE));
+
+    result = _mm_or_si128(result, _mm_and_si128(isSoft, _mm_set1_epi16(HF_SOFT)));
+    result = _mm_or_si128(result, _mm_and_si128(isBust, _mm_set1_epi16(HF_BUST)));
+
+    result = _mm_or_si128(
+        result,
+        _mm_and_si128(isBlackjack, _mm_set1_epi16(HF_BLACKJACK))
+    );
+
+    *totals = total, *flags = result;
+}
+
+/* SSE2 명령어 집합으로 16개 단위의 패를 계산하고, 계산한 패의 개수를 반환한다. */
+__attribute__((target("sse2")))
+static int EvaluateHandBatchSSE2(const HandBatch *batch, HandBatchResult *result) {
+    const __m128i zero = _mm_setzero_si128();
+
+    int length = batch->length & ~15;
+
+    for (int i = 0; i < length; i += 16) {
+        __m128i lowCounts[RANK_COUNT], highCounts[RANK_COUNT];
+
+        for (int r = 0; r < RANK_COUNT; r++) {
+            __m128i counts = _mm_loadu_si128(
+                (const __m128i *) (batch->counts[r] + i)
+            );
+
+            lowCounts[r] = _mm_unpacklo_epi8(counts, zero);
+            highCounts[r] = _mm_unpackhi_epi8(counts, zero);
+        }
+
+        __m128i lowTotals, lowFlags, highTotals, highFlags;
+
+        EvaluateHandLanesSSE2(lowCounts, &lowTotals, &lowFlags);
+        EvaluateHandLanesSSE2(highCounts, &highTotals, &highFlags);
+
+        _mm_storeu_si128(
+            (__m128i *) (result->totals + i),
+            _mm_packus_epi16(lowTotals, highTotals)
+        );
+
+        _mm_storeu_si128(
+            (__m128i *) (result->flags + i),
+            _mm_packus_epi16(lowFlags, highFlags)
+        );
+    }
+
+    return length;
+}
+
+/* AVX2 명령어 집합으로 16비트 정수 16개에 해당하는 패를 계산한다. */
+__attribute__((target("avx2")))
+static inline void EvaluateHandLanesAVX2(
+    const __m256i *counts,
+    __m256i *totals,
+    __m256i *flags
+) {
+    const __m256i zero = _mm256_setzero_si256();
+
+    __m256i hardTotal = zero, cardCount = zero;
+
+    for (int r = 0; r < RANK_COUNT; r++) {
+        hardTotal = _mm256_add_epi16(
+            hardTotal,
+            _mm256_mullo_epi16(counts[r], _mm256_set1_epi16(r + 1))
+        );
+
+        cardCount = _mm256_add_epi16(cardCount, counts[r]);
+    }
+
+    __m256i hasAce = _mm256_cmpgt_epi16(counts[0], zero);
+
+    __m256i isSoft = _mm256_and_si256(
+        hasAce,
+        _mm256_cmpgt_epi16(_mm256_set1_epi16(MAX_SOFT_TOTAL + 1), hardTotal)
+    );
+
+    __m256i total = _mm256_add_epi16(
+        hardTotal,
+        _mm256_and_si256(isSoft, _mm256_set1_epi16(SOFT_HAND_BONUS))
+    );
+
+    __m256i isBust = _mm256_cmpgt_epi16(hardTotal, _mm256_set1_epi16(BLACKJACK));
+
+    __m256i isBlackjack = _mm256_and_si256(
+        _mm256_cmpeq_epi16(cardCount, _mm256_set1_epi16(2)),
+        _mm256_cmpeq_epi16(total, _mm256_set1_epi16(BLACKJACK))
+    );
+
+    __m256i result = _mm256_and_si256(hasAce, _mm256_set1_epi16(HF_ACE));
+
+    result = _mm256_or_si256(
+        result,
+        _mm256_and_si256(isSoft, _mm256_set1_epi16(HF_SOFT))
+    );
+
+    result = _mm256_or_si256(
+        result,
+        _mm256_and_si256(isBust, _mm256_set1_epi16(HF_BUST))
+    );
+
+    result = _mm256_or_si256(
+        result,
+        _mm256_and_si256(isBlackjack, _mm256_set1_epi16(HF_BLACKJACK))
+    );
+
+    *totals = total, *flags = result;
+}
+
+/* AVX2 명령어 집합으로 32개 단위의 패를 계산하고, 계산한 패의 개수를 반환한다. */
+__attribute__((target("avx2")))
+static int EvaluateHandBatchAVX2(const HandBatch *batch, HandBatchResult *result) {
+    int length = batch->length & ~31;
+
+    for (int i = 0; i < length; i += 32) {
+        __m256i lowCounts[RANK_COUNT], highCounts[RANK_COUNT];
+
+        for (int r = 0; r < RANK_COUNT; r++) {
+            lowCounts[r] = _mm256_cvtepu8_epi16(
+                _mm_loadu_si128((const __m128i *) (batch->counts[r] + i))
+            );
+
+            highCounts[r] = _mm256_cvtepu8_epi16(
+                _mm_loadu_si128((const __m128i *) (batch->counts[r] + i + 16))
+            );
+        }
+
+        __m256i lowTotals, lowFlags, highTotals, highFlags;
+
+        EvaluateHandLanesAVX2(lowCounts, &lowTotals, &lowFlags);
+        EvaluateHandLanesAVX2(highCounts, &highTotals, &highFlags);
+
+        // `_mm256_packus_epi16()`은 128비트 단위로 섞이므로, 순서를 되돌린다.
+        __m256i totals = _mm256_permute4x64_epi64(
+            _mm256_packus_epi16(lowTotals, highTotals),
+            _MM_SHUFFLE(3, 1, 2, 0)
+        );
+
+        __m256i flags = _mm256_permute4x64_epi64(
+            _mm256_packus_epi16(lowFlags, highFlags),
+            _MM_SHUFFLE(3, 1, 2, 0)
+        );
+
+        _mm256_storeu_si256((__m256i *) (result->totals + i), totals);
+        _mm256_storeu_si256((__m256i *) (result->flags + i), flags);
+    }
+
+    return length;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,454 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "b021-engine.h"
+
+/* | `bot` 모듈 매크로 정의... | */
+
+#define SOFT_ROW_OFFSET   CHART_HARD_ROW_COUNT
+#define PAIR_ROW_OFFSET   (CHART_HARD_ROW_COUNT + CHART_SOFT_ROW_COUNT)
+
+#define STAND_ROW         CHART_ROW_COUNT
+#define INSURANCE_ROW     (CHART_ROW_COUNT + 1)
+
+#define LOW_BUCKET        0
+#define BASE_BUCKET       1
+#define HIGH_BUCKET       2
+
+/* 하드 `total`에 해당하는 행 번호. */
+#define HARD_ROW(total)   ((total) - 5)
+
+/* 값이 `value`인 카드의 페어에 해당하는 행 번호. (에이스는 11) */
+#define PAIR_ROW(value)   (PAIR_ROW_OFFSET + (value) - 2)
+
+/* 딜러의 첫 번째 카드의 값이 `value`인 열 번호. (에이스는 11) */
+#define COLUMN(value)     ((value) - 2)
+
+/* | `bot` 모듈 자료형 정의... | */
+
+/* 봇 플레이어가 행동을 고르는 우선순위. */
+typedef struct BotPriority {
+    uint8_t actions[_PA_COUNT];  // 먼저 고를 행동부터 나열한 행동의 목록.
+    int length;                  // 행동의 개수.
+} BotPriority;
+
+/* 트루 카운트에 따라 기본 전략표를 바꾸는 칸. */
+typedef struct BotDeviation {
+    uint8_t row, column;  // 기본 전략표의 칸.
+    uint8_t high, low;    // 트루 카운트가 기준 이상일 때와 기준보다 작을 때의 행동.
+    int8_t count;         // 기준이 되는 트루 카운트.
+} BotDeviation;
+
+/* | `bot` 모듈 상수... | */
+
+/* 딜러의 첫 번째 카드의 랭크에 따른 열 번호. */
+static const uint8_t columnIndices[RANK_COUNT] = { 9, 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+
+/*
+    Hi-Lo 트루 카운트에 따라 기본 전략표를 바꾸는 칸.
+
+    Don Schlesinger의 "Illustrious 18"과 "Fab 4" 서렌더 변형이며, 같은 칸에
+    두 항목이 있으면 (15 대 10) 두 기준으로 트루 카운트의 구간을 세 개로 나눈다.
+*/
+static const BotDeviation botDeviations[] = {
+    { INSURANCE_ROW, COLUMN(11), PA_INSURANCE, PA_STAND, 3 },
+    { HARD_ROW(16), COLUMN(10), PA_STAND, PA_HIT, 0 },
+    { HARD_ROW(15), COLUMN(10), PA_STAND, PA_HIT, 4 },
+    { PAIR_ROW(10), COLUMN(5), PA_SPLIT, PA_STAND, 5 },
+    { PAIR_ROW(10), COLUMN(6), PA_SPLIT, PA_STAND, 4 },
+    { HARD_ROW(10), COLUMN(10), PA_DOUBLE, PA_HIT, 4 },
+    { HARD_ROW(12), COLUMN(3), PA_STAND, PA_HIT, 2 },
+    { HARD_ROW(12), COLUMN(2), PA_STAND, PA_HIT, 3 },
+    { HARD_ROW(11), COLUMN(11), PA_DOUBLE, PA_HIT, 1 },
+    { HARD_ROW(9), COLUMN(2), PA_DOUBLE, PA_HIT, 1 },
+    { HARD_ROW(10), COLUMN(11), PA_DOUBLE, PA_HIT, 4 },
+    { HARD_ROW(9), COLUMN(7), PA_DOUBLE, PA_HIT, 3 },
+    { HARD_ROW(16), COLUMN(9), PA_STAND, PA_HIT, 5 },
+    { HARD_ROW(13), COLUMN(2), PA_STAND, PA_HIT, -1 },
+    { HARD_ROW(12), COLUMN(4), PA_STAND, PA_HIT, 0 },
+    { HARD_ROW(12), COLUMN(5), PA_STAND, PA_HIT, -2 },
+    { HARD_ROW(12), COLUMN(6), PA_STAND, PA_HIT, -1 },
+    { HARD_ROW(13), COLUMN(3), PA_STAND, PA_HIT, -2 },
+    { HARD_ROW(14), COLUMN(10), PA_SURRENDER, PA_HIT, 3 },
+    { HARD_ROW(15), COLUMN(10), PA_SURRENDER, PA_HIT, 0 },
+    { HARD_ROW(15), COLUMN(9), PA_SURRENDER, PA_HIT, 2 },
+    { HARD_ROW(15), COLUMN(11), PA_SURRENDER, PA_HIT, 1 }
+};
+
+/* | `bot` 모듈 함수... | */
+
+/* 패의 소프트, 페어 여부와 합에 해당하는 행 번호를 반환한다. */
+static int GetBotRow(bool soft, bool pair, int total);
+
+/* 행에 해당하는 패의 합과 소프트 여부를 구한다. */
+static void GetBotRowTotal(int row, int *total, bool *soft);
+
+/* 나눌 수 없는 페어가 대신 따르는 하드 행 번호를 반환한다. */
+static int GetPairFallbackRow(int row);
+
+/* 칸과 칸의 대안이 되는 하드 행의 트루 카운트 기준을 작은 것부터 구하고, 그 개수를 반환한다. */
+static int GetDeviationCounts(
+    BotType type,
+    const StrategyChart *chart,
+    int row,
+    int column,
+    int8_t *counts
+);
+
+/* 봇 플레이어가 트루 카운트가 `count`일 때 칸에서 행동을 고르는 우선순위를 구한다. */
+static void GetCellPriority(
+    BotType type,
+    const StrategyChart *chart,
+    int row,
+    int column,
+    int count,
+    BotPriority *priority
+);
+
+/* 트루 카운트에 따라 바꿀 행동을 우선순위에 반영한다. */
+static void ApplyDeviation(BotPriority *priority, PlayerAction action);
+
+/* 우선순위에 없는 행동을 맨 뒤에 추가한다. */
+static void AddPriorityAction(BotPriority *priority, PlayerAction action);
+
+/* 우선순위에서 행동을 제거한다. */
+static void RemovePriorityAction(BotPriority *priority, PlayerAction action);
+
+/* 우선순위를 선택할 수 있는 행동의 비트마스크별 행동표로 만든다. */
+static void CompilePriority(
+    BotPolicy *bot,
+    int bucket,
+    int row,
+    int column,
+    const BotPriority *priority
+);
+
+/* 주어진 종류의 봇 플레이어의 행동표를 만든다. */
+bool InitBotPolicy(BotPolicy *bot, BotType type, const StrategyChart *chart) {
+    if (bot == NULL || type < 0 || type >= _BT_COUNT) return false;
+
+    if ((type == BT_BASIC_STRATEGY || type == BT_COUNT_DEVIATION) && chart == NULL)
+        return false;
+
+    bot->type = type;
+
+    for (int kind = 0; kind < 4; kind++)
+        for (int total = 0; total < BOT_TOTAL_COUNT; total++)
+            bot->rows[kind][total] = GetBotRow(kind & 1, kind & 2, total);
+
+    for (int row = 0; row < BOT_ROW_COUNT; row++) {
+        for (int column = 0; column < CHART_COLUMN_COUNT; column++) {
+            int8_t counts[BOT_BUCKET_COUNT - 1];
+
+            const int countCount = GetDeviationCounts(type, chart, row, column, counts);
+
+            // 기준이 없으면 기본 구간만 사용하도록, 트루 카운트가 도달할 수 없는 기준을 둔다.
+            bot->minCounts[row][column] = (countCount > 0) ? counts[0] : INT8_MIN;
+            bot->maxCounts[row][column] = (countCount > 0) ? counts[countCount - 1] : INT8_MAX;
+
+            for (int bucket = LOW_BUCKET; bucket <= HIGH_BUCKET; bucket++) {
+                // 구간에 속하는 트루 카운트 하나로 그 구간의 우선순위를 구한다.
+                const int count = (bucket == LOW_BUCKET)
+                    ? bot->minCounts[row][column] - 1
+                    : (bucket == BASE_BUCKET)
+                        ? bot->minCounts[row][column]
+                        : bot->maxCounts[row][column];
+
+                BotPriority priority;
+
+                GetCellPriority(type, chart, row, column, count, &priority);
+
+                CompilePriority(bot, bucket, row, column, &priority);
+            }
+        }
+    }
+
+    return true;
+}
+
+/* 블랙잭 테이블에서 차례인 좌석의 봇 플레이어가 할 행동을 반환한다. */
+PlayerAction GetBotAction(const Table *table, void *userData) {
+    const BotPolicy *bot = userData;
+
+    if (table == NULL || bot == NULL || table->dealerHand.length <= 0) return PA_STAND;
+
+    const Hand *hand = &table->playerHands[table->activeSeat][table->activeHand];
+
+    const int row = (table->state == GS_INSURANCE)
+        ? INSURANCE_ROW
+        : bot->rows[(hand->flags & (HF_SOFT | HF_PAIR)) >> 1]
+            [hand->total & (BOT_TOTAL_COUNT - 1)];
+
+    const int column = columnIndices[GetCardRank(table->dealerHand.cards[0])];
+
+    const double count = (bot->type == BT_COUNT_DEVIATION)
+        ? GetTrueCount(&table->count, CT_HI_LO, table->shoe.length)
+        : 0.0;
+
+    const int bucket = BASE_BUCKET
+        + (count >= bot->maxCounts[row][column])
+        - (count < bot->minCounts[row][column]);
+
+    // 인슈어런스는 스탠드와 함께만 선택할 수 있으므로, 스탠드 비트에 합친다.
+    const uint8_t actions = GetTableActions(table);
+
+    return bot->actions[bucket][row][column]
+        [(actions | (actions >> PA_INSURANCE)) & (BOT_ACTION_MASK_COUNT - 1)];
+}
+
+/* 블랙잭 테이블에서 차례인 좌석에 앉은 봇 플레이어가 할 행동을 반환한다. */
+PlayerAction GetSeatBotAction(const Table *table, void *userData) {
+    const BotPolicy *const *bots = userData;
+
+    if (table == NULL || bots == NULL) return PA_STAND;
+
+    return GetBotAction(table, (void *) bots[table->activeSeat]);
+}
+
+/* 패의 소프트, 페어 여부와 합에 해당하는 행 번호를 반환한다. */
+static int GetBotRow(bool soft, bool pair, int total) {
+    if (total >= BLACKJACK) return STAND_ROW;
+
+    // 페어의 합으로 페어의 카드 값을 알 수 있으며, 소프트 12는 에이스 페어이다.
+    if (pair && soft && total == 12) return PAIR_ROW(11);
+    else if (pair && !soft && total >= 4 && total <= 20 && total % 2 == 0)
+        return PAIR_ROW(total / 2);
+
+    if (soft) return SOFT_ROW_OFFSET + ((total < 13) ? 0 : total - 13);
+
+    return HARD_ROW((total < 5) ? 5 : total);
+}
+
+/* 행에 해당하는 패의 합과 소프트 여부를 구한다. */
+static void GetBotRowTotal(int row, int *total, bool *soft) {
+    if (row < SOFT_ROW_OFFSET) {
+        *total = row + 5, *soft = false;
+    } else if (row < PAIR_ROW_OFFSET) {
+        *total = (row - SOFT_ROW_OFFSET) + 13, *soft = true;
+    } else if (row < CHART_ROW_COUNT) {
+        const int value = (row - PAIR_ROW_OFFSET) + 2;
+
+        *soft = (value == 11), *total = *soft ? 12 : 2 * value;
+    } else {
+        *total = BLACKJACK, *soft = false;
+    }
+}
+
+/* 나눌 수 없는 페어가 대신 따르는 하드 행 번호를 반환한다. */
+static int GetPairFallbackRow(int row) {
+    int total;
+    bool soft;
+
+    GetBotRowTotal(row, &total, &soft);
+
+    // 에이스 페어는 하드 행 대신 카드를 받는다.
+    if (row < PAIR_ROW_OFFSET || row >= CHART_ROW_COUNT || soft) return -1;
+
+    return HARD_ROW((total < 5) ? 5 : total);
+}
+
+/* 칸과 칸의 대안이 되는 하드 행의 트루 카운트 기준을 작은 것부터 구하고, 그 개수를 반환한다. */
+static int GetDeviationCounts(
+    BotType type,
+    const StrategyChart *chart,
+    int row,
+    int column,
+    int8_t *counts
+) {
+    if (type != BT_COUNT_DEVIATION) return 0;
+
+    const int fallbackRow = GetPairFallbackRow(row);
+
+    int length = 0;
+
+    for (int i = 0; i < (int) (sizeof(botDeviations) / sizeof(*botDeviations)); i++) {
+        const BotDeviation *deviation = &botDeviations[i];
+
+        if (deviation->column != column
+            || (deviation->row != row && deviation->row != fallbackRow)) continue;
+
+        if (deviation->high == PA_SURRENDER && !chart->rules.surrender) continue;
+
+        int j = 0;
+
+        while (j < length && counts[j] < deviation->count) j++;
+
+        // 구간은 세 개뿐이므로, 같은 기준이나 세 번째 기준은 무시한다.
+        if ((j < length && counts[j] == deviation->count) || length >= BOT_BUCKET_COUNT - 1)
+            continue;
+
+        memmove(counts + j + 1, counts + j, length - j);
+
+        counts[j] = deviation->count;
+        length++;
+    }
+
+    return length;
+}
+
+/*
+    봇 플레이어가 트루 카운트가 `count`일 때 칸에서 행동을 고르는 우선순위를
+    구한다.
+
+    나눌 수 없는 페어는 같은 트루 카운트에서 하드 행의 우선순위를 따르므로,
+    하드 행의 변형도 함께 반영된다.
+*/
+static void GetCellPriority(
+    BotType type,
+    const StrategyChart *chart,
+    int row,
+    int column,
+    int count,
+    BotPriority *priority
+) {
+    priority->length = 0;
+
+    int total;
+    bool soft;
+
+    GetBotRowTotal(row, &total, &soft);
+
+    if (row >= STAND_ROW) {
+        // 무조건 스탠드하는 행과 인슈어런스 행은 변형이 없으면 스탠드한다.
+    } else if (type == BT_ALWAYS_HIT) {
+        AddPriorityAction(priority, PA_HIT);
+    } else if (type == BT_NEVER_BUST) {
+        // 하드 12 이상은 10을 받으면 버스트되고, 소프트 18 미만은 버스트되지 않는다.
+        if (soft ? (total < 18) : (total < 12)) AddPriorityAction(priority, PA_HIT);
+    } else {
+        const PlayerAction best = chart->actions[row][column];
+
+        AddPriorityAction(priority, best);
+
+        if (row >= PAIR_ROW_OFFSET) {
+            BotPriority fallback = { .length = 0 };
+
+            // 서렌더할 수 없는 페어는 나누고, 나눌 수 없는 페어는 패의 합으로 결정한다.
+            if (best == PA_SURRENDER) AddPriorityAction(priority, PA_SPLIT);
+
+            if (soft) AddPriorityAction(&fallback, PA_HIT);
+            else GetCellPriority(type, chart, GetPairFallbackRow(row), column, count, &fallback);
+
+            for (int i = 0; i < fallback.length; i++)
+                AddPriorityAction(priority, fallback.actions[i]);
+        } else if (best == PA_DOUBLE) {
+            // 더블다운할 수 없는 소프트 18 이상은 스탠드하고, 나머지는 카드를 받는다.
+            if (soft && total >= 18) AddPriorityAction(priority, PA_STAND);
+            else AddPriorityAction(priority, PA_HIT);
+        } else if (best == PA_SURRENDER) {
+            // 서렌더할 수 없는 하드 17 이상은 스탠드하고, 나머지는 카드를 받는다.
+            if (!soft && total >= 17) AddPriorityAction(priority, PA_STAND);
+            else AddPriorityAction(priority, PA_HIT);
+        }
+    }
+
+    AddPriorityAction(priority, PA_STAND);
+
+    for (int i = 0; type == BT_COUNT_DEVIATION
+        && i < (int) (sizeof(botDeviations) / sizeof(*botDeviations)); i++) {
+        const BotDeviation *deviation = &botDeviations[i];
+
+        if (deviation->row != row || deviation->column != column) continue;
+
+        if (deviation->high == PA_SURRENDER && !chart->rules.surrender) continue;
+
+        // 서렌더 변형은 기준보다 낮은 카운트에서 서렌더하지 않는 것도 포함한다.
+        if (deviation->high == PA_SURRENDER) RemovePriorityAction(priority, PA_SURRENDER);
+
+        ApplyDeviation(
+            priority,
+            (count >= deviation->count) ? deviation->high : deviation->low
+        );
+    }
+}
+
+/*
+    트루 카운트에 따라 바꿀 행동을 우선순위에 반영한다.
+
+    바꿀 행동이 서렌더가 아닌데 기본 전략이 서렌더라면, 서렌더를 할 수
+    없을 때의 대안만 바꾼다.
+*/
+static void ApplyDeviation(BotPriority *priority, PlayerAction action) {
+    RemovePriorityAction(priority, action);
+
+    const int index = (priority->length > 0 && priority->actions[0] == PA_SURRENDER
+        && action != PA_SURRENDER) ? 1 : 0;
+
+    memmove(
+        priority->actions + index + 1,
+        priority->actions + index,
+        priority->length - index
+    );
+
+    priority->actions[index] = action;
+    priority->length++;
+}
+
+/* 우선순위에 없는 행동을 맨 뒤에 추가한다. */
+static void AddPriorityAction(BotPriority *priority, PlayerAction action) {
+    for (int i = 0; i < priority->length; i++)
+        if (priority->actions[i] == action) return;
+
+    priority->actions[priority->length++] = action;
+}
+
+/* 우선순위에서 행동을 제거한다. */
+static void RemovePriorityAction(BotPriority *priority, PlayerAction action) {
+    int length = 0;
+
+    for (int i = 0; i < priority->length; i++)
+        if (priority->actions[i] != action)
+            priority->actions[length++] = priority->actions[i];
+
+    priority->length = length;
+}
+
+/* 우선순위를 선택할 수 있는 행동의 비트마스크별 행동표로 만든다. */
+static void CompilePriority(
+    BotPolicy *bot,
+    int bucket,
+    int row,
+    int column,
+    const BotPriority *priority
+) {
+    uint8_t *actions = bot->actions[bucket][row][column];
+
+    for (int mask = 0; mask < BOT_ACTION_MASK_COUNT; mask++) {
+        actions[mask] = PA_STAND;
+
+        // 인슈어런스는 인슈어런스 행에서만, 선택할 수 있는 행동과 관계없이 고른다.
+        for (int i = 0; i < priority->length; i++) {
+            const PlayerAction action = priority->actions[i];
+
+            if ((action == PA_INSURANCE && row == INSURANCE_ROW) || (mask & (1 << action))) {
+                actions[mask] = action;
+
+                break;
+            }
+        }
+    }
+}
\ No newline at end of file
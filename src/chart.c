@@ -0,0 +1,524 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "b021-engine.h"
+
+/* | `chart` 모듈 매크로 정의... | */
+
+#define RULE_DOUBLE_AFTER_SPLIT  0x01
+#define RULE_SURRENDER           0x02
+#define RULE_HITS_SOFT_17        0x04
+#define RULE_BLACKJACK_6_TO_5    0x08
+
+#define CHART_HEADER_SIZE        8
+#define CHART_RECORD_SIZE        (4 + CHART_ROW_COUNT * CHART_COLUMN_COUNT)
+
+#define CHART_CELL_COUNT         (CHART_ROW_COUNT * CHART_COLUMN_COUNT)
+
+/* | `chart` 모듈 상수... | */
+
+/* 전략표 파일의 시그니처. */
+static const uint8_t chartMagic[4] = { 'B', '0', '2', 'C' };
+
+/* CSV 파일에 기록할 행동별 문자. */
+static const char actionSymbols[_PA_COUNT] = { 'S', 'H', 'D', 'P', 'R', 'I' };
+
+/* | `chart` 모듈 자료형 정의... | */
+
+/* 작업 스레드가 계산할 칸 번호의 범위. */
+typedef struct ChartQueue {
+    pthread_mutex_t lock;  // 범위를 보호하는 뮤텍스.
+    int begin, end;        // 남은 칸 번호의 범위.
+} ChartQueue;
+
+/* 전략표 계산 작업 스레드. */
+typedef struct ChartWorker {
+    pthread_t thread;           // 작업 스레드.
+    struct ChartPool *pool;     // 작업 스레드가 속한 스레드 풀.
+    Solver *solver;             // 작업 스레드 전용 전략 계산기.
+    ChartQueue queue;           // 작업 스레드에 남은 칸 번호의 범위.
+    int id;                     // 작업 스레드의 번호.
+} ChartWorker;
+
+/* 전략표 계산 스레드 풀. */
+typedef struct ChartPool {
+    StrategyChart *charts;  // 계산할 전략표 배열.
+    ChartWorker *workers;   // 작업 스레드 배열.
+    int workerCount;        // 작업 스레드의 수.
+} ChartPool;
+
+/* | `chart` 모듈 함수... | */
+
+/* 작업 스레드에서 남은 칸이 없을 때까지 전략표의 칸을 계산한다. */
+static void *RunChartWorker(void *arg);
+
+/* 작업 스레드의 범위에서 칸 번호를 하나 꺼낸다. */
+static bool PopChartCell(ChartWorker *worker, int *cell);
+
+/* 다른 작업 스레드 중 남은 칸이 가장 많은 스레드에서 남은 칸의 절반을 가져온다. */
+static bool StealChartCells(ChartWorker *worker);
+
+/* 전략표의 칸 하나를 계산한다. */
+static void SolveChartCell(Solver *solver, StrategyChart *chart, int row, int column);
+
+/* 전략표의 행에 해당하는 플레이어의 패를 만든다. */
+static void GetChartRowHand(int row, Hand *hand);
+
+/* 전략표의 행 이름을 반환한다. */
+static void GetChartRowName(int row, char *buffer, size_t size);
+
+/* 바이트 배열에 리틀 엔디언 정수를 기록한다. */
+static void PutUint(uint8_t *data, uint64_t value, int size);
+
+/* 바이트 배열에서 리틀 엔디언 정수를 읽는다. */
+static uint64_t GetUint(const uint8_t *data, int size);
+
+/* 여러 규칙에 대한 기본 전략표를 `threadCount`개의 스레드로 한 번에 계산한다. */
+bool GenerateStrategyCharts(StrategyChart *charts, int chartCount, int threadCount) {
+    if (charts == NULL || chartCount <= 0) return false;
+
+    const int cellCount = chartCount * CHART_CELL_COUNT;
+
+    if (threadCount < 1) threadCount = 1;
+    else if (threadCount > cellCount) threadCount = cellCount;
+
+    ChartPool pool = { .charts = charts, .workerCount = threadCount };
+
+    pool.workers = calloc(threadCount, sizeof(*pool.workers));
+
+    if (pool.workers == NULL) return false;
+
+    bool result = true;
+
+    /*
+        처음에는 칸 번호를 연속된 범위로 나눠준다. 같은 전략표와 같은 딜러의
+        카드에 대한 칸들이 한 스레드에 모이므로, 전략 계산기의 캐시를 잘
+        활용할 수 있다.
+    */
+    for (int i = 0; i < threadCount; i++) {
+        ChartWorker *worker = &pool.workers[i];
+
+        worker->pool = &pool;
+        worker->id = i;
+
+        worker->queue.begin = (int) ((int64_t) cellCount * i / threadCount);
+        worker->queue.end = (int) ((int64_t) cellCount * (i + 1) / threadCount);
+
+        pthread_mutex_init(&worker->queue.lock, NULL);
+
+        worker->solver = malloc(sizeof(*worker->solver));
+
+        if (worker->solver == NULL) result = false;
+        else InitSolver(worker->solver);
+    }
+
+    if (result) {
+        int threadsCreated = 1;
+
+        // 첫 번째 작업은 이 함수를 호출한 스레드에서 진행한다.
+        for (; threadsCreated < threadCount; threadsCreated++) {
+            ChartWorker *worker = &pool.workers[threadsCreated];
+
+            if (pthread_create(&worker->thread, NULL, RunChartWorker, worker) != 0) break;
+        }
+
+        RunChartWorker(&pool.workers[0]);
+
+        for (int i = 1; i < threadsCreated; i++)
+            pthread_join(pool.workers[i].thread, NULL);
+    }
+
+    for (int i = 0; i < threadCount; i++) {
+        pthread_mutex_destroy(&pool.workers[i].queue.lock);
+
+        free(pool.workers[i].solver);
+    }
+
+    free(pool.workers);
+
+    return result;
+}
+
+/* 기본 전략표들을 바이너리 파일로 저장한다. */
+bool SaveStrategyCharts(const char *path, const StrategyChart *charts, int chartCount) {
+    if (path == NULL || charts == NULL || chartCount <= 0 || chartCount > UINT16_MAX)
+        return false;
+
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL) return false;
+
+    uint8_t header[CHART_HEADER_SIZE] = { 0 };
+
+    memcpy(header, chartMagic, sizeof(chartMagic));
+
+    header[4] = CHART_VERSION;
+    header[5] = CHART_ROW_COUNT;
+
+    PutUint(header + 6, chartCount, 2);
+
+    bool result = (fwrite(header, sizeof(header), 1, file) == 1);
+
+    for (int i = 0; result && i < chartCount; i++) {
+        const Rules *rules = &charts[i].rules;
+
+        uint8_t record[CHART_RECORD_SIZE];
+
+        record[0] = rules->deckCount;
+        record[1] = rules->splitHandCount;
+        record[2] = (rules->doubleAfterSplit ? RULE_DOUBLE_AFTER_SPLIT : 0)
+            | (rules->surrender ? RULE_SURRENDER : 0)
+            | (rules->dealerHitsSoft17 ? RULE_HITS_SOFT_17 : 0)
+            | ((rules->blackjackPayout == BP_6_TO_5) ? RULE_BLACKJACK_6_TO_5 : 0);
+        record[3] = 0;
+
+        memcpy(record + 4, charts[i].actions, sizeof(charts[i].actions));
+
+        result = (fwrite(record, sizeof(record), 1, file) == 1);
+    }
+
+    return (fclose(file) == 0) && result;
+}
+
+/* 바이너리 파일에서 기본 전략표들을 불러오고, 불러온 전략표의 수를 반환한다. */
+int LoadStrategyCharts(const char *path, StrategyChart *charts, int maxCount) {
+    if (path == NULL || charts == NULL || maxCount <= 0) return -1;
+
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL) return -1;
+
+    uint8_t header[CHART_HEADER_SIZE];
+
+    if (fread(header, sizeof(header), 1, file) != 1
+        || memcmp(header, chartMagic, sizeof(chartMagic)) != 0
+        || header[4] != CHART_VERSION || header[5] != CHART_ROW_COUNT) {
+        fclose(file);
+
+        return -1;
+    }
+
+    int chartCount = (int) GetUint(header + 6, 2);
+
+    if (chartCount > maxCount) chartCount = maxCount;
+
+    for (int i = 0; i < chartCount; i++) {
+        uint8_t record[CHART_RECORD_SIZE];
+
+        if (fread(record, sizeof(record), 1, file) != 1) {
+            fclose(file);
+
+            return -1;
+        }
+
+        StrategyChart *chart = &charts[i];
+
+        chart->rules = GetDefaultRules();
+
+        chart->rules.deckCount = record[0];
+        chart->rules.splitHandCount = record[1];
+        chart->rules.doubleAfterSplit = record[2] & RULE_DOUBLE_AFTER_SPLIT;
+        chart->rules.surrender = record[2] & RULE_SURRENDER;
+        chart->rules.dealerHitsSoft17 = record[2] & RULE_HITS_SOFT_17;
+        chart->rules.blackjackPayout = (record[2] & RULE_BLACKJACK_6_TO_5)
+            ? BP_6_TO_5
+            : BP_3_TO_2;
+
+        memcpy(chart->actions, record + 4, sizeof(chart->actions));
+
+        // 기댓값은 파일에 저장하지 않는다.
+        memset(chart->evs, 0, sizeof(chart->evs));
+
+        for (int j = 0; j < CHART_CELL_COUNT; j++) {
+            if (chart->actions[j / CHART_COLUMN_COUNT][j % CHART_COLUMN_COUNT] < _PA_COUNT)
+                continue;
+
+            fclose(file);
+
+            return -1;
+        }
+    }
+
+    fclose(file);
+
+    return chartCount;
+}
+
+/* 기본 전략표들을 사람이 읽을 수 있는 CSV 파일로 저장한다. */
+bool ExportStrategyChartsCsv(const char *path, const StrategyChart *charts, int chartCount) {
+    if (path == NULL || charts == NULL || chartCount <= 0) return false;
+
+    FILE *file = fopen(path, "w");
+
+    if (file == NULL) return false;
+
+    fputs("decks,h17,das,surrender,hand,2,3,4,5,6,7,8,9,10,A\n", file);
+
+    for (int i = 0; i < chartCount; i++) {
+        const StrategyChart *chart = &charts[i];
+
+        for (int row = 0; row < CHART_ROW_COUNT; row++) {
+            char name[8];
+
+            GetChartRowName(row, name, sizeof(name));
+
+            fprintf(
+                file,
+                "%d,%d,%d,%d,%s",
+                chart->rules.deckCount,
+                chart->rules.dealerHitsSoft17,
+                chart->rules.doubleAfterSplit,
+                chart->rules.surrender,
+                name
+            );
+
+            for (int column = 0; column < CHART_COLUMN_COUNT; column++)
+                fprintf(file, ",%c", actionSymbols[chart->actions[row][column]]);
+
+            fputc('\n', file);
+        }
+    }
+
+    return (fclose(file) == 0);
+}
+
+/* 규칙이 `rules`와 같은 기본 전략표를 찾는다. */
+const StrategyChart *FindStrategyChart(
+    const StrategyChart *charts,
+    int chartCount,
+    const Rules *rules
+) {
+    if (charts == NULL || rules == NULL) return NULL;
+
+    // 블랙잭 승리 시의 배당은 카드를 받은 뒤의 결정에 영향을 주지 않는다.
+    for (int i = 0; i < chartCount; i++)
+        if (charts[i].rules.deckCount == rules->deckCount
+            && charts[i].rules.dealerHitsSoft17 == rules->dealerHitsSoft17
+            && charts[i].rules.doubleAfterSplit == rules->doubleAfterSplit
+            && charts[i].rules.surrender == rules->surrender)
+            return &charts[i];
+
+    return NULL;
+}
+
+/* 작업 스레드에서 남은 칸이 없을 때까지 전략표의 칸을 계산한다. */
+static void *RunChartWorker(void *arg) {
+    ChartWorker *worker = arg;
+
+    for (;;) {
+        int cell;
+
+        if (!PopChartCell(worker, &cell)) {
+            if (!StealChartCells(worker)) break;
+
+            continue;
+        }
+
+        const int chartIndex = cell / CHART_CELL_COUNT;
+
+        // 같은 딜러의 카드에 대한 칸들이 연속되도록 열 단위로 번호를 매긴다.
+        const int row = cell % CHART_ROW_COUNT;
+        const int column = (cell % CHART_CELL_COUNT) / CHART_ROW_COUNT;
+
+        SolveChartCell(worker->solver, &worker->pool->charts[chartIndex], row, column);
+    }
+
+    return NULL;
+}
+
+/* 작업 스레드의 범위에서 칸 번호를 하나 꺼낸다. */
+static bool PopChartCell(ChartWorker *worker, int *cell) {
+    ChartQueue *queue = &worker->queue;
+
+    bool result = false;
+
+    pthread_mutex_lock(&queue->lock);
+
+    if (queue->begin < queue->end) {
+        *cell = queue->begin++;
+
+        result = true;
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return result;
+}
+
+/* 다른 작업 스레드 중 남은 칸이 가장 많은 스레드에서 남은 칸의 절반을 가져온다. */
+static bool StealChartCells(ChartWorker *worker) {
+    ChartPool *pool = worker->pool;
+
+    for (;;) {
+        ChartWorker *victim = NULL;
+
+        int maxRemaining = 0;
+
+        // 가져올 스레드를 고른 뒤에 다시 잠그므로, 그 사이에 남은 칸의 수가 바뀔 수 있다.
+        for (int i = 1; i < pool->workerCount; i++) {
+            ChartWorker *other = &pool->workers[(worker->id + i) % pool->workerCount];
+
+            pthread_mutex_lock(&other->queue.lock);
+
+            const int remaining = other->queue.end - other->queue.begin;
+
+            pthread_mutex_unlock(&other->queue.lock);
+
+            if (remaining > maxRemaining) victim = other, maxRemaining = remaining;
+        }
+
+        if (victim == NULL) return false;
+
+        int begin = 0, end = 0;
+
+        // 원래 스레드는 범위의 앞쪽부터 계산하므로, 뒤쪽 절반을 가져온다.
+        pthread_mutex_lock(&victim->queue.lock);
+
+        const int remaining = victim->queue.end - victim->queue.begin;
+
+        if (remaining > 0) {
+            end = victim->queue.end;
+            begin = end - (remaining + 1) / 2;
+
+            victim->queue.end = begin;
+        }
+
+        pthread_mutex_unlock(&victim->queue.lock);
+
+        // 잠그기 전에 다른 스레드가 먼저 가져갔다면, 다시 찾는다.
+        if (begin == end) continue;
+
+        pthread_mutex_lock(&worker->queue.lock);
+
+        worker->queue.begin = begin;
+        worker->queue.end = end;
+
+        pthread_mutex_unlock(&worker->queue.lock);
+
+        return true;
+    }
+}
+
+/* 전략표의 칸 하나를 계산한다. */
+static void SolveChartCell(Solver *solver, StrategyChart *chart, int row, int column) {
+    const Rules *rules = &chart->rules;
+
+    // 열은 2 ~ 10, 에이스 순서이다.
+    const int upcard = (column + 1) % RANK_COUNT;
+
+    Hand hand;
+
+    GetChartRowHand(row, &hand);
+
+    // 새 카드 슈에서 플레이어의 카드와 딜러의 첫 번째 카드를 뺀 구성을 사용한다.
+    RankCounts counts = { .total = rules->deckCount * MAX_CARD_COUNT };
+
+    for (int rank = 0; rank < RANK_COUNT; rank++)
+        counts.counts[rank] = rules->deckCount * ((rank == RANK_COUNT - 1) ? 16 : 4);
+
+    for (int i = 0; i < hand.length; i++)
+        counts.counts[GetCardRank(hand.cards[i])]--, counts.total--;
+
+    counts.counts[upcard]--, counts.total--;
+
+    SolverResult result;
+
+    SolveHand(solver, rules, &hand, upcard, &counts, &result);
+
+    uint8_t available = result.available;
+
+    // 하드 20은 10 페어로 만들지만, 페어가 아닌 행에서는 카드를 나누지 않는다.
+    if (row < CHART_HARD_ROW_COUNT + CHART_SOFT_ROW_COUNT)
+        available &= ~(1 << PA_SPLIT);
+
+    PlayerAction best = PA_STAND;
+
+    for (int i = 0; i < _PA_COUNT; i++)
+        if ((available & (1 << i)) && result.ev[i] > result.ev[best])
+            best = i;
+
+    chart->actions[row][column] = best;
+    chart->evs[row][column] = (float) result.ev[best];
+}
+
+/* 전략표의 행에 해당하는 플레이어의 패를 만든다. */
+static void GetChartRowHand(int row, Hand *hand) {
+    int first, second;
+
+    if (row < CHART_HARD_ROW_COUNT) {
+        const int total = row + 5;
+
+        // 하드 5 ~ 11은 2와 나머지 카드로, 하드 12 ~ 20은 10과 나머지 카드로 만든다.
+        if (total <= 11) first = 2, second = total - 2;
+        else first = 10, second = total - 10;
+    } else if (row < CHART_HARD_ROW_COUNT + CHART_SOFT_ROW_COUNT) {
+        first = 1, second = (row - CHART_HARD_ROW_COUNT) + 2;
+    } else {
+        // 페어는 2 ~ 10, 에이스 순서이다.
+        first = second = ((row - CHART_HARD_ROW_COUNT - CHART_SOFT_ROW_COUNT + 1)
+            % RANK_COUNT) + 1;
+    }
+
+    ClearHand(hand);
+
+    AddHandCard(hand, MAKE_CARD(SU_SPADE, first - 1));
+    AddHandCard(hand, MAKE_CARD(SU_HEART, second - 1));
+}
+
+/* 전략표의 행 이름을 반환한다. */
+static void GetChartRowName(int row, char *buffer, size_t size) {
+    if (row < CHART_HARD_ROW_COUNT) {
+        snprintf(buffer, size, "H%d", row + 5);
+    } else if (row < CHART_HARD_ROW_COUNT + CHART_SOFT_ROW_COUNT) {
+        snprintf(buffer, size, "S%d", (row - CHART_HARD_ROW_COUNT) + 13);
+    } else {
+        const int value = ((row - CHART_HARD_ROW_COUNT - CHART_SOFT_ROW_COUNT + 1)
+            % RANK_COUNT) + 1;
+
+        if (value == 1) snprintf(buffer, size, "A-A");
+        else snprintf(buffer, size, "%d-%d", value, value);
+    }
+}
+
+/* 바이트 배열에 리틀 엔디언 정수를 기록한다. */
+static void PutUint(uint8_t *data, uint64_t value, int size) {
+    for (int i = 0; i < size; i++)
+        data[i] = (value >> (8 * i)) & 0xFF;
+}
+
+/* 바이트 배열에서 리틀 엔디언 정수를 읽는다. */
+static uint64_t GetUint(const uint8_t *data, int size) {
+    uint64_t value = 0;
+
+    for (int i = 0; i < size; i++)
+        value |= (uint64_t) data[i] << (8 * i);
+
+    return value;
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "b021-engine.h"
+
+/* | `count` 모듈 상수... | */
+
+/* 카드의 인덱스에 따라 카드 카운팅 방식별로 매기는 점수. */
+static const int8_t countTags[MAX_CARD_NUMBER][_CT_COUNT] = {
+    { -1, -1,  0 },  // A
+    {  1,  1,  1 },  // 2
+    {  1,  1,  1 },  // 3
+    {  1,  1,  2 },  // 4
+    {  1,  1,  2 },  // 5
+    {  1,  1,  2 },  // 6
+    {  0,  1,  1 },  // 7
+    {  0,  0,  0 },  // 8
+    {  0,  0, -1 },  // 9
+    { -1, -1, -2 },  // 10
+    { -1, -1, -2 },  // J
+    { -1, -1, -2 },  // Q
+    { -1, -1, -2 }   // K
+};
+
+/* | `count` 모듈 함수... | */
+
+/*
+    카드 카운팅 상태를 초기화한다.
+
+    KO 방식은 덱 하나당 점수의 합이 4인 불균형 방식이므로,
+    러닝 카운트를 `4 - 4 * deckCount`에서 시작한다.
+*/
+void ResetCardCount(CardCount *count, int deckCount) {
+    if (count == NULL) return;
+
+    for (int i = 0; i < _CT_COUNT; i++)
+        count->running[i] = 0;
+
+    count->running[CT_KO] = 4 - 4 * deckCount;
+}
+
+/* 공개된 카드 한 장으로 모든 카드 카운팅 방식의 러닝 카운트를 갱신한다. */
+void UpdateCardCount(CardCount *count, Card card) {
+    if (count == NULL) return;
+
+    const int8_t *tags = countTags[GET_CARD_INDEX(card)];
+
+    for (int i = 0; i < _CT_COUNT; i++)
+        count->running[i] += tags[i];
+}
+
+/* 주어진 카드 카운팅 방식의 러닝 카운트를 반환한다. */
+int GetRunningCount(const CardCount *count, CountSystem system) {
+    if (count == NULL || system < 0 || system >= _CT_COUNT) return 0;
+
+    return count->running[system];
+}
+
+/* 주어진 카드 카운팅 방식의 러닝 카운트를 남은 덱의 수로 나눈 트루 카운트를 반환한다. */
+double GetTrueCount(const CardCount *count, CountSystem system, int remainingCards) {
+    if (count == NULL || system < 0 || system >= _CT_COUNT) return 0.0;
+
+    // 남은 카드가 반 덱보다 적으면, 반 덱이 남은 것으로 계산한다.
+    if (remainingCards < MAX_CARD_COUNT / 2) remainingCards = MAX_CARD_COUNT / 2;
+
+    return (double) count->running[system] * MAX_CARD_COUNT / remainingCards;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "b021-engine.h"
+
+/* | `csm` 모듈 매크로 정의... | */
+
+#define CSM_TRAY_CARD_COUNT  10
+
+/* | `csm` 모듈 함수... | */
+
+/*
+    연속 셔플 기계의 배출구에서 카드를 한 장 꺼내고, 기계 안의 카드 중
+    하나를 무작위로 골라 배출구의 빈 자리를 채운다.
+
+    카드 슈의 배열에서 맨 위의 `CSM_TRAY_CARD_COUNT`장은 배출구에 나와 있는
+    카드이고, 나머지는 기계 안의 카드이다. 사용한 카드를 기계 안의 무작위
+    위치에 넣는 것은 기계 안의 카드 순서를 무작위 순열로 유지하는 것과
+    같으므로, 기계 안의 카드는 순서 없이 보관하고 꺼낼 때 무작위로 고른다.
+*/
+Card TakeCsmCard(Shoe *shoe, RandomState *rs) {
+    Card card = shoe->cards[--shoe->length];
+
+    if (shoe->length >= CSM_TRAY_CARD_COUNT) {
+        const int bottom = shoe->length - CSM_TRAY_CARD_COUNT;
+
+        const int i = GetBoundedRandom(rs, bottom + 1);
+
+        Card temp = shoe->cards[i];
+
+        shoe->cards[i] = shoe->cards[bottom];
+        shoe->cards[bottom] = temp;
+    }
+
+    return card;
+}
+
+/* 사용한 카드를 연속 셔플 기계에 다시 넣는다. */
+bool ReturnCsmCard(Shoe *shoe, Card card) {
+    if (shoe == NULL || shoe->length >= shoe->capacity) return false;
+
+    // 배출구의 카드들을 한 칸씩 올리고, 빈 자리를 기계 안에 넣은 카드로 채운다.
+    const int bottom = (shoe->length > CSM_TRAY_CARD_COUNT)
+        ? shoe->length - CSM_TRAY_CARD_COUNT
+        : 0;
+
+    memmove(
+        &shoe->cards[bottom + 1],
+        &shoe->cards[bottom],
+        (shoe->length - bottom) * sizeof(*shoe->cards)
+    );
+
+    shoe->cards[bottom] = card;
+
+    shoe->length++;
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "b021-engine.h"
+
+/* | `dealer` 모듈 매크로 정의... | */
+
+#define CACHE_ENTRY_VALID  0x01
+#define CACHE_ENTRY_PEEK   0x02
+#define CACHE_ENTRY_H17    0x04
+
+#define MAX_PROBE_COUNT    8
+
+/* | `dealer` 모듈 함수... | */
+
+/* 딜러가 카드를 받는 모든 경우를 탐색하여 확률 분포를 계산한다. */
+static void PlayDealerHand(
+    RankCounts *counts,
+    int hardTotal,
+    bool hasAce,
+    int cardCount,
+    bool peek,
+    bool hitsSoft17,
+    double probability,
+    double *p
+);
+
+/* 딜러 패의 확률 분포 캐시를 초기화한다. */
+void InitDealerCache(DealerCache *cache) {
+    if (cache == NULL) return;
+
+    memset(cache, 0, sizeof(*cache));
+}
+
+/* 카드 슈의 구성과 딜러의 첫 번째 카드에 대한 딜러 패의 확률 분포를 계산한다. */
+void GetDealerDistribution(
+    DealerCache *cache,
+    const RankCounts *counts,
+    int upcard,
+    bool peek,
+    bool hitsSoft17,
+    DealerDistribution *result
+) {
+    if (counts == NULL || result == NULL || upcard < 0 || upcard >= RANK_COUNT)
+        return;
+
+    // 딜러가 블랙잭을 확인하는 경우는 첫 번째 카드가 에이스나 10점 카드일 때뿐이다.
+    peek = peek && (upcard == 0 || upcard == RANK_COUNT - 1);
+
+    const uint8_t flags = CACHE_ENTRY_VALID | (peek ? CACHE_ENTRY_PEEK : 0)
+        | (hitsSoft17 ? CACHE_ENTRY_H17 : 0);
+
+    DealerCacheEntry *slot = NULL;
+
+    if (cache != NULL) {
+        const uint64_t hash = HashRankCounts(counts)
+            ^ ((uint64_t) ((upcard << 2) | (hitsSoft17 << 1) | peek) * 0x9E3779B97F4A7C15ULL);
+
+        for (int i = 0; i < MAX_PROBE_COUNT; i++) {
+            DealerCacheEntry *entry = &cache->entries[(hash + i) & (DEALER_CACHE_SIZE - 1)];
+
+            if (!(entry->flags & CACHE_ENTRY_VALID)) {
+                if (slot == NULL) slot = entry;
+
+                continue;
+            }
+
+            if (entry->flags == flags && entry->upcard == upcard
+                && memcmp(entry->counts.counts, counts->counts, sizeof(counts->counts)) == 0) {
+                cache->hits++;
+
+                *result = entry->distribution;
+
+                return;
+            }
+        }
+
+        // 빈 자리가 없으면 첫 번째 자리의 항목을 교체한다.
+        if (slot == NULL) slot = &cache->entries[hash & (DEALER_CACHE_SIZE - 1)];
+
+        cache->misses++;
+    }
+
+    RankCounts temp = *counts;
+
+    *result = (DealerDistribution) { .p = { 0.0 } };
+
+    PlayDealerHand(&temp, upcard + 1, upcard == 0, 1, peek, hitsSoft17, 1.0, result->p);
+
+    if (slot != NULL) {
+        slot->counts = *counts;
+        slot->upcard = upcard;
+        slot->flags = flags;
+        slot->distribution = *result;
+    }
+}
+
+/* 딜러가 카드를 받는 모든 경우를 탐색하여 확률 분포를 계산한다. */
+static void PlayDealerHand(
+    RankCounts *counts,
+    int hardTotal,
+    bool hasAce,
+    int cardCount,
+    bool peek,
+    bool hitsSoft17,
+    double probability,
+    double *p
+) {
+    const bool soft = hasAce && hardTotal <= BLACKJACK - 10;
+
+    const int total = soft ? hardTotal + 10 : hardTotal;
+
+    if (cardCount == 2 && total == BLACKJACK) {
+        p[DO_BLACKJACK] += probability;
+
+        return;
+    }
+
+    if (hardTotal > BLACKJACK) {
+        p[DO_BUST] += probability;
+
+        return;
+    }
+
+    // 규칙에 따라 딜러는 소프트 17에서도 카드를 받는다.
+    if (cardCount >= 2 && total >= DEALER_STAND_TOTAL
+        && !(hitsSoft17 && soft && total == DEALER_STAND_TOTAL)) {
+        p[DO_17 + (total - DEALER_STAND_TOTAL)] += probability;
+
+        return;
+    }
+
+    // 딜러가 블랙잭이 아닌 경우, 두 번째 카드로 블랙잭이 되는 카드는 나올 수 없다.
+    int excluded = -1;
+
+    if (peek && cardCount == 1)
+        excluded = hasAce ? RANK_COUNT - 1 : 0;
+
+    const int cardTotal = counts->total
+        - ((excluded >= 0) ? counts->counts[excluded] : 0);
+
+    // 카드 슈가 비어 있으면, 현재 패로 게임을 끝낸 것으로 처리한다.
+    if (cardTotal <= 0) {
+        p[(total >= DEALER_STAND_TOTAL) ? DO_17 + (total - DEALER_STAND_TOTAL) : DO_17]
+            += probability;
+
+        return;
+    }
+
+    for (int rank = 0; rank < RANK_COUNT; rank++) {
+        if (rank == excluded || counts->counts[rank] == 0) continue;
+
+        const double q = probability * counts->counts[rank] / cardTotal;
+
+        counts->counts[rank]--, counts->total--;
+
+        PlayDealerHand(
+            counts,
+            hardTotal + rank + 1,
+            hasAce || rank == 0,
+            cardCount + 1,
+            peek,
+            hitsSoft17,
+            q,
+            p
+        );
+
+        counts->counts[rank]++, counts->total++;
+    }
+}
\ No newline at end of file
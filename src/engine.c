@@ -0,0 +1,999 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "b021-engine.h"
+
+/* | `engine` 모듈 매크로 정의... | */
+
+#ifdef __GNUC__
+    #define ALWAYS_INLINE  inline __attribute__((always_inline))
+#else
+    #define ALWAYS_INLINE  inline
+#endif
+
+/* 카드 슈의 종류별로 특수화된 함수의 이름을 만든다. */
+#define SHOE_VARIANT_NAME(name, csm)  name##_##csm
+
+/* 규칙 조합별로 특수화된 함수의 이름을 만든다. */
+#define VARIANT_NAME(name, csm, h17, das, payout, ls, split) \
+    name##_##csm##_##h17##_##das##_##payout##_##ls##_##split
+
+/* 최대 패의 수마다 `X(csm, h17, das, payout, ls, split)`를 한 번씩 전개한다. */
+#define FOR_EACH_SPLIT_HAND_COUNT(X, csm, h17, das, payout, ls) \
+    X(csm, h17, das, payout, ls, 1) X(csm, h17, das, payout, ls, 2) \
+    X(csm, h17, das, payout, ls, 3) X(csm, h17, das, payout, ls, 4)
+
+/* 서렌더 가능 여부마다 `X(csm, h17, das, payout, ls, split)`를 전개한다. */
+#define FOR_EACH_SURRENDER(X, csm, h17, das, payout) \
+    FOR_EACH_SPLIT_HAND_COUNT(X, csm, h17, das, payout, 0) \
+    FOR_EACH_SPLIT_HAND_COUNT(X, csm, h17, das, payout, 1)
+
+/* 카드 슈의 종류가 `csm`인 모든 규칙 조합마다 `X(csm, h17, das, payout, ls, split)`를 전개한다. */
+#define FOR_EACH_SHOE_RULES(X, csm) \
+    FOR_EACH_SURRENDER(X, csm, 0, 0, 0) FOR_EACH_SURRENDER(X, csm, 0, 0, 1) \
+    FOR_EACH_SURRENDER(X, csm, 0, 1, 0) FOR_EACH_SURRENDER(X, csm, 0, 1, 1) \
+    FOR_EACH_SURRENDER(X, csm, 1, 0, 0) FOR_EACH_SURRENDER(X, csm, 1, 0, 1) \
+    FOR_EACH_SURRENDER(X, csm, 1, 1, 0) FOR_EACH_SURRENDER(X, csm, 1, 1, 1)
+
+/* 지원하는 모든 규칙 조합마다 `X(csm, h17, das, payout, ls, split)`를 한 번씩 전개한다. */
+#define FOR_EACH_TABLE_VARIANT(X) \
+    FOR_EACH_SHOE_RULES(X, 0) FOR_EACH_SHOE_RULES(X, 1)
+
+/* 카드 슈의 종류에 맞게 특수화된 카드 분배 함수들을 정의한다. */
+#define DEFINE_SHOE_VARIANT(csm)                                                      \
+    static bool SHOE_VARIANT_NAME(DealCard, csm)(Table *table, bool toPlayer) {       \
+        return DealTableCardImpl(table, toPlayer, csm);                               \
+    }                                                                                 \
+                                                                                      \
+    static void SHOE_VARIANT_NAME(DealInitialCards, csm)(Table *table) {              \
+        DealInitialCardsImpl(table, csm);                                             \
+    }                                                                                 \
+                                                                                      \
+    static void SHOE_VARIANT_NAME(Reset, csm)(Table *table) {                         \
+        ResetTableImpl(table, csm);                                                   \
+    }
+
+/* 규칙 조합에 맞게 특수화된 게임 진행 함수들을 정의한다. */
+#define DEFINE_TABLE_VARIANT(csm, h17, das, payout, ls, split)                             \
+    static uint8_t VARIANT_NAME(GetActions, csm, h17, das, payout, ls, split)(             \
+        const Table *table                                                                 \
+    ) {                                                                                    \
+        return GetTableActionsImpl(table, das, ls, split);                                 \
+    }                                                                                      \
+                                                                                           \
+    static void VARIANT_NAME(PlayDealerTurn, csm, h17, das, payout, ls, split)(            \
+        Table *table                                                                       \
+    ) {                                                                                    \
+        PlayDealerTurnImpl(table, csm, h17, payout);                                       \
+    }                                                                                      \
+                                                                                           \
+    static RoundResult VARIANT_NAME(PlayRound, csm, h17, das, payout, ls, split)(          \
+        Table *table,                                                                      \
+        int standTotal                                                                     \
+    ) {                                                                                    \
+        return PlayTableRoundImpl(table, standTotal, csm, h17, payout);                    \
+    }
+
+/* 규칙 조합에 맞게 특수화된 게임 진행 함수들을 `tableVariants`에 등록한다. */
+#define REGISTER_TABLE_VARIANT(csm, h17, das, payout, ls, split)                           \
+    [csm][h17][das][payout][ls][split - 1] = {                                             \
+        .dealCard = SHOE_VARIANT_NAME(DealCard, csm),                                      \
+        .dealInitialCards = SHOE_VARIANT_NAME(DealInitialCards, csm),                      \
+        .reset = SHOE_VARIANT_NAME(Reset, csm),                                            \
+        .getActions = VARIANT_NAME(GetActions, csm, h17, das, payout, ls, split),          \
+        .playDealerTurn = VARIANT_NAME(PlayDealerTurn, csm, h17, das, payout, ls, split),  \
+        .playRound = VARIANT_NAME(PlayRound, csm, h17, das, payout, ls, split)             \
+    },
+
+/* | `engine` 모듈 자료형 정의... | */
+
+/* 블랙잭 게임의 규칙 조합에 맞게 특수화된 게임 진행 함수들의 구조체. */
+struct TableVariant {
+    bool (*dealCard)(Table *table, bool toPlayer);           // 카드를 한 장 나눠준다.
+    void (*dealInitialCards)(Table *table);                  // 처음 두 장의 카드를 나눠준다.
+    void (*reset)(Table *table);                             // 블랙잭 테이블을 초기화한다.
+    uint8_t (*getActions)(const Table *table);               // 선택 가능한 행동을 반환한다.
+    void (*playDealerTurn)(Table *table);                    // 딜러의 차례를 진행한다.
+    RoundResult (*playRound)(Table *table, int standTotal);  // 게임을 한 판 진행한다.
+};
+
+/* | `engine` 모듈 상수... | */
+
+/* 블랙잭 카드의 인덱스에 따른 카드 값. */
+static const uint8_t cardValues[MAX_CARD_NUMBER] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10
+};
+
+// 덱 한 벌에 들어 있는 카드의 점수 합 (에이스는 1점으로 센다).
+#define DECK_HARD_TOTAL  340
+
+// 패 하나에 들어갈 수 있는 카드의 점수 합의 최댓값 (21점인 패가 10점 카드를 받은 경우).
+#define MAX_HAND_HARD_TOTAL  (BLACKJACK + 10)
+
+#define W RR_PLAYER_WIN
+#define L RR_DEALER_WIN
+#define P RR_PUSH
+#define B RR_PLAYER_BLACKJACK
+
+/* 플레이어 (행)와 딜러 (열)의 점수에 따른 게임의 결과. */
+static const uint8_t resultTable[HAND_SCORE_COUNT][HAND_SCORE_COUNT] = {
+    { P, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 0
+    { W, P, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 1
+    { W, W, P, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 2
+    { W, W, W, P, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 3
+    { W, W, W, W, P, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 4
+    { W, W, W, W, W, P, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 5
+    { W, W, W, W, W, W, P, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 6
+    { W, W, W, W, W, W, W, P, L, L, L, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 7
+    { W, W, W, W, W, W, W, W, P, L, L, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 8
+    { W, W, W, W, W, W, W, W, W, P, L, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 9
+    { W, W, W, W, W, W, W, W, W, W, P, L, L, L, L, L, L, L, L, L, L, L, W, L },  // 10
+    { W, W, W, W, W, W, W, W, W, W, W, P, L, L, L, L, L, L, L, L, L, L, W, L },  // 11
+    { W, W, W, W, W, W, W, W, W, W, W, W, P, L, L, L, L, L, L, L, L, L, W, L },  // 12
+    { W, W, W, W, W, W, W, W, W, W, W, W, W, P, L, L, L, L, L, L, L, L, W, L },  // 13
+    { W, W, W, W, W, W, W, W, W, W, W, W, W, W, P, L, L, L, L, L, L, L, W, L },  // 14
+    { W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, P, L, L, L, L, L, L, W, L },  // 15
+    { W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, P, L, L, L, L, L, W, L },  // 16
+    { W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, P, L, L, L, L, W, L },  // 17
+    { W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, P, L, L, L, W, L },  // 18
+    { W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, P, L, L, W, L },  // 19
+    { W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, P, L, W, L },  // 20
+    { W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, P, W, L },  // 21
+    { L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L },  // 버스트
+    { B, B, B, B, B, B, B, B, B, B, B, B, B, B, B, B, B, B, B, B, B, B, B, P }   // 블랙잭
+};
+
+#undef B
+#undef P
+#undef L
+#undef W
+
+/* 블랙잭 승리를 제외한 게임 결과에 따른 베팅 금액 1에 대한 플레이어의 손익. */
+static const double resultPayouts[_RR_COUNT] = {
+    [RR_PLAYER_WIN] = 1.0,
+    [RR_DEALER_WIN] = -1.0,
+    [RR_SURRENDER] = -0.5
+};
+
+/* 블랙잭 승리 시의 배당. */
+static const double blackjackPayouts[_BP_COUNT] = {
+    [BP_3_TO_2] = 1.5,
+    [BP_6_TO_5] = 1.2
+};
+
+/* 규칙 조합별로 특수화된 게임 진행 함수들. */
+static const TableVariant tableVariants[2][2][2][_BP_COUNT][2][MAX_SPLIT_HAND_COUNT];
+
+/* | `engine` 모듈 함수... | */
+
+
+/* `seat`번 이후의 좌석 중에서 인슈어런스를 결정할 첫 번째 좌석을 반환한다. */
+static int GetInsuranceSeat(const Table *table, int seat);
+
+/* 딜러의 블랙잭 여부를 확인하고, 플레이어의 차례를 시작한다. */
+static void PeekDealerHand(Table *table);
+
+/* 차례인 좌석에서 진행 중인 패를 두 개의 패로 나눈다. */
+static void SplitPlayerHand(Table *table);
+
+/* 카드를 더 받을 수 있는 다음 패로 차례를 넘긴다. */
+static void AdvancePlayerHand(Table *table);
+
+/* 지난 게임에서 사용한 카드를 모두 연속 셔플 기계에 다시 넣는다. */
+static void ReturnTableCards(Table *table);
+
+/* 딜러의 차례를 진행한다. */
+static void PlayDealerTurn(Table *table);
+
+/* 주어진 종류의 카드 슈에서 카드를 한 장 뽑는다. */
+static ALWAYS_INLINE bool DealTableCardImpl(Table *table, bool toPlayer, bool continuousShuffle);
+
+/* 모든 좌석과 딜러에게 카지노의 순서대로 처음 두 장의 카드를 나눠준다. */
+static ALWAYS_INLINE void DealInitialCardsImpl(Table *table, bool continuousShuffle);
+
+/* 주어진 종류의 카드 슈를 사용하는 블랙잭 테이블을 초기화한다. */
+static ALWAYS_INLINE void ResetTableImpl(Table *table, bool continuousShuffle);
+
+/* 주어진 규칙으로 블랙잭 테이블에서 선택할 수 있는 행동의 비트마스크를 반환한다. */
+static ALWAYS_INLINE uint8_t GetTableActionsImpl(
+    const Table *table,
+    bool doubleAfterSplit,
+    bool surrender,
+    int splitHandCount
+);
+
+/* 주어진 규칙으로 딜러의 차례를 진행하고, 게임의 결과를 정산한다. */
+static ALWAYS_INLINE void PlayDealerTurnImpl(
+    Table *table,
+    bool continuousShuffle,
+    bool hitsSoft17,
+    BlackjackPayout payout
+);
+
+/* 주어진 규칙으로 블랙잭 테이블에서 게임을 한 판 진행한다. */
+static ALWAYS_INLINE RoundResult PlayTableRoundImpl(
+    Table *table,
+    int standTotal,
+    bool continuousShuffle,
+    bool hitsSoft17,
+    BlackjackPayout payout
+);
+
+/* 블랙잭 게임의 기본 규칙을 반환한다. */
+Rules GetDefaultRules(void) {
+    return (Rules) {
+        .deckCount = DEFAULT_DECK_COUNT,
+        .penetration = DEFAULT_PENETRATION,
+        .seatCount = DEFAULT_SEAT_COUNT,
+        .splitHandCount = DEFAULT_SPLIT_HAND_COUNT,
+        .doubleAfterSplit = true,
+        .surrender = true,
+        .dealerHitsSoft17 = false,
+        .blackjackPayout = BP_3_TO_2
+    };
+}
+
+/* 블랙잭 게임의 규칙에 따른 블랙잭 승리 시의 배당을 반환한다. */
+double GetBlackjackPayout(const Rules *rules) {
+    if (rules == NULL || rules->blackjackPayout < 0
+        || rules->blackjackPayout >= _BP_COUNT) return blackjackPayouts[BP_3_TO_2];
+
+    return blackjackPayouts[rules->blackjackPayout];
+}
+
+/* 블랙잭 게임의 규칙으로 만든 블랙잭 테이블이 실제로 사용하는 덱의 수를 반환한다. */
+int GetTableDeckCount(const Rules *rules) {
+    if (rules == NULL) return GetDefaultRules().deckCount;
+
+    int deckCount = rules->deckCount;
+
+    if (deckCount < 1) deckCount = 1;
+    else if (deckCount > MAX_DECK_COUNT) deckCount = MAX_DECK_COUNT;
+
+    if (!rules->continuousShuffle) return deckCount;
+
+    int seatCount = rules->seatCount, splitHandCount = rules->splitHandCount;
+
+    if (seatCount < 1) seatCount = 1;
+    else if (seatCount > MAX_SEAT_COUNT) seatCount = MAX_SEAT_COUNT;
+
+    if (splitHandCount < 1) splitHandCount = 1;
+    else if (splitHandCount > MAX_SPLIT_HAND_COUNT) splitHandCount = MAX_SPLIT_HAND_COUNT;
+
+    // 딜러의 패를 포함한 모든 패가 가질 수 있는 카드의 점수 합보다 기계 안의 점수 합이 커야 한다.
+    const int maxTableHardTotal = MAX_HAND_HARD_TOTAL * (seatCount * splitHandCount + 1);
+
+    while (deckCount < MAX_DECK_COUNT && deckCount * DECK_HARD_TOTAL <= maxTableHardTotal)
+        deckCount++;
+
+    return deckCount;
+}
+
+/* 주어진 규칙과 시드 값으로 블랙잭 테이블을 생성한다. */
+void InitTable(Table *table, const Rules *rules, uint64_t seed, int stream) {
+    if (table == NULL) return;
+
+    table->rules = (rules != NULL) ? *rules : GetDefaultRules();
+
+    if (table->rules.penetration < MIN_PENETRATION)
+        table->rules.penetration = MIN_PENETRATION;
+    else if (table->rules.penetration > MAX_PENETRATION)
+        table->rules.penetration = MAX_PENETRATION;
+
+    if (table->rules.seatCount < 1)
+        table->rules.seatCount = 1;
+    else if (table->rules.seatCount > MAX_SEAT_COUNT)
+        table->rules.seatCount = MAX_SEAT_COUNT;
+
+    if (table->rules.splitHandCount < 1)
+        table->rules.splitHandCount = 1;
+    else if (table->rules.splitHandCount > MAX_SPLIT_HAND_COUNT)
+        table->rules.splitHandCount = MAX_SPLIT_HAND_COUNT;
+
+    if (table->rules.blackjackPayout < 0 || table->rules.blackjackPayout >= _BP_COUNT)
+        table->rules.blackjackPayout = BP_3_TO_2;
+
+    // 연속 셔플 기계는 게임 도중에 비지 않도록 덱의 수를 늘린다.
+    table->rules.deckCount = GetTableDeckCount(&table->rules);
+
+    // 규칙에 맞게 특수화된 게임 진행 함수는 테이블마다 한 번만 고른다.
+    table->variant = &tableVariants
+        [table->rules.continuousShuffle]
+        [table->rules.dealerHitsSoft17]
+        [table->rules.doubleAfterSplit]
+        [table->rules.blackjackPayout]
+        [table->rules.surrender]
+        [table->rules.splitHandCount - 1];
+
+    InitRandomState(&table->random, seed);
+
+    for (int i = 0; i < stream; i++)
+        JumpRandomState(&table->random);
+
+    table->shoe.shuffleCount = 0;
+
+    // 아직 카드를 나눠주지 않았으므로, 연속 셔플 기계에 다시 넣을 카드도 없다.
+    table->state = GS_INIT;
+
+    GenerateTableShoe(table);
+
+    ResetTable(table);
+}
+
+/* 블랙잭 테이블을 초기화한다. */
+void ResetTable(Table *table) {
+    if (table == NULL) return;
+
+    table->variant->reset(table);
+}
+
+/* 블랙잭 테이블의 카드 슈를 생성하고 섞는다. */
+void GenerateTableShoe(Table *table) {
+    if (table == NULL) return;
+
+    Shoe *shoe = &table->shoe;
+
+    const int deckCount = table->rules.deckCount;
+
+    shoe->capacity = shoe->length = deckCount * MAX_CARD_COUNT;
+
+    for (int i = 0; i < shoe->capacity; i++)
+        shoe->cards[i] = MAKE_CARD(
+            (i / MAX_CARD_NUMBER) % _SU_COUNT,
+            i % MAX_CARD_NUMBER
+        );
+
+    // 카드 슈의 구성은 섞는 순서와 관계없으므로, 덱의 수로 바로 계산한다.
+    shoe->counts = (RankCounts) { .total = shoe->capacity };
+
+    for (int i = 0; i < RANK_COUNT - 1; i++)
+        shoe->counts.counts[i] = deckCount * _SU_COUNT;
+
+    shoe->counts.counts[RANK_COUNT - 1] = deckCount
+        * _SU_COUNT * (MAX_CARD_NUMBER - (RANK_COUNT - 1));
+
+    ResetCardCount(&table->count, deckCount);
+
+    /* https://en.wikipedia.org/wiki/Fisher%E2%80%93Yates_shuffle */
+
+    for (int i = shoe->capacity - 1; i >= 1; i--) {
+        int j = GetBoundedRandom(&table->random, i + 1);
+
+        Card temp = shoe->cards[i];
+
+        shoe->cards[i] = shoe->cards[j];
+        shoe->cards[j] = temp;
+    }
+
+    // 컷 카드는 카드 슈의 사용 비율에 해당하는 위치에 꽂는다.
+    shoe->cutCard = shoe->capacity
+        - (int) (table->rules.penetration * shoe->capacity);
+
+    shoe->shuffleCount++;
+}
+
+/* 블랙잭 테이블의 카드 슈에서 컷 카드가 나왔는지 확인한다. */
+bool IsTableShoeCut(const Table *table) {
+    // 연속 셔플 기계에는 컷 카드가 없다.
+    return (table != NULL) && !table->rules.continuousShuffle
+        && table->shoe.length <= table->shoe.cutCard;
+}
+
+/* 블랙잭 테이블의 덱에서 카드를 한 장 뽑는다. */
+bool DealTableCard(Table *table, bool toPlayer) {
+    if (table == NULL) return false;
+
+    return table->variant->dealCard(table, toPlayer);
+}
+
+/* 블랙잭 테이블에서 지금 선택할 수 있는 행동의 비트마스크를 반환한다. */
+uint8_t GetTableActions(const Table *table) {
+    if (table == NULL) return 0;
+
+    return table->variant->getActions(table);
+}
+
+/* 플레이어의 행동에 따라 블랙잭 테이블의 게임 상태를 변경한다. */
+bool TakeTableTurn(Table *table, PlayerAction action) {
+    if (table == NULL || action < 0 || action >= _PA_COUNT) return false;
+
+    switch (table->state) {
+        case GS_INIT:
+            table->variant->dealInitialCards(table);
+
+            // 딜러의 첫 번째 카드가 에이스이면, 인슈어런스를 먼저 결정한다.
+            if (GET_CARD_INDEX(table->dealerHand.cards[0]) == 0
+                && (table->activeSeat = GetInsuranceSeat(table, 0)) < table->rules.seatCount)
+                table->state = GS_INSURANCE;
+            else
+                PeekDealerHand(table);
+
+            return true;
+
+        case GS_INSURANCE:
+            table->insured[table->activeSeat] = (action == PA_INSURANCE);
+
+            // 모든 좌석이 인슈어런스를 결정해야 딜러의 패를 확인한다.
+            table->activeSeat = GetInsuranceSeat(table, table->activeSeat + 1);
+
+            if (table->activeSeat < table->rules.seatCount) return true;
+
+            PeekDealerHand(table);
+
+            return true;
+
+        case GS_PLAYER_TURN:
+            break;
+
+        default:
+            return false;
+    }
+
+    if (!(GetTableActions(table) & (1 << action))) return false;
+
+    const int seat = table->activeSeat;
+
+    const Hand *hand = &table->playerHands[seat][table->activeHand];
+
+    switch (action) {
+        case PA_HIT:
+            // 더 이상 카드를 받을 수 없으면 차례를 넘긴다.
+            if (!DealTableCard(table, true) || hand->total >= BLACKJACK)
+                AdvancePlayerHand(table);
+
+            break;
+
+        case PA_DOUBLE:
+            table->playerHandFlags[seat][table->activeHand] |= PH_DOUBLED;
+
+            DealTableCard(table, true);
+
+            AdvancePlayerHand(table);
+
+            break;
+
+        case PA_SPLIT:
+            SplitPlayerHand(table);
+
+            break;
+
+        case PA_SURRENDER:
+            table->playerHandFlags[seat][table->activeHand] |= PH_SURRENDERED;
+
+            AdvancePlayerHand(table);
+
+            break;
+
+        default:
+            AdvancePlayerHand(table);
+
+            break;
+    }
+
+    return true;
+}
+
+/* 블랙잭 테이블에서 게임을 한 판 진행하고, 그 결과를 반환한다. */
+RoundResult PlayTableRound(Table *table, int standTotal) {
+    if (table == NULL) return RR_NONE;
+
+    return table->variant->playRound(table, standTotal);
+}
+
+/*
+    블랙잭 테이블에서 `policy`가 정하는 행동으로 게임을 한 판 진행하고,
+    베팅 금액 1에 대한 플레이어의 손익을 반환한다.
+*/
+double PlayTablePolicyRound(Table *table, PlayerPolicy policy, void *userData) {
+    if (table == NULL || policy == NULL) return 0.0;
+
+    ResetTable(table);
+
+    TakeTableTurn(table, PA_STAND);
+
+    while (table->state != GS_ROUND_END)
+        if (!TakeTableTurn(table, policy(table, userData)))
+            TakeTableTurn(table, PA_STAND);
+
+    return table->payout;
+}
+
+/* 블랙잭 카드의 값을 반환한다. */
+int GetCardValue(Card card) {
+    return cardValues[GET_CARD_INDEX(card)];
+}
+
+/* 블랙잭 카드의 랭크를 반환한다. */
+int GetCardRank(Card card) {
+    return cardValues[GET_CARD_INDEX(card)] - 1;
+}
+
+/* 블랙잭 카드 슈에 남아있는 카드의 구성을 반환한다. */
+void GetShoeRankCounts(const Shoe *shoe, RankCounts *counts) {
+    if (shoe == NULL || counts == NULL) return;
+
+    *counts = shoe->counts;
+}
+
+/* 주어진 카드 구성에서 다음 카드의 랭크가 `rank`일 확률을 반환한다. */
+double GetRankProbability(const RankCounts *counts, int rank) {
+    if (counts == NULL || counts->total == 0
+        || rank < 0 || rank >= RANK_COUNT) return 0.0;
+
+    return (double) counts->counts[rank] / counts->total;
+}
+
+/* 주어진 카드 구성에서 카드를 한 장 더 받았을 때 패가 버스트될 확률을 반환한다. */
+double GetBustProbability(const RankCounts *counts, const Hand *hand) {
+    if (counts == NULL || hand == NULL || counts->total == 0) return 0.0;
+
+    if (hand->flags & HF_BUST) return 1.0;
+
+    // 에이스는 1점으로 세므로, 랭크가 `BLACKJACK - hardTotal` 이상이면 버스트된다.
+    int bustCount = 0;
+
+    for (int i = BLACKJACK - hand->hardTotal; i < RANK_COUNT; i++)
+        bustCount += counts->counts[i];
+
+    return (double) bustCount / counts->total;
+}
+
+/* 블랙잭 카드 슈의 구성에 대한 해시 값을 계산한다. */
+uint64_t HashRankCounts(const RankCounts *counts) {
+    /* https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function */
+
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    for (int i = 0; i < RANK_COUNT; i++)
+        hash = (hash ^ counts->counts[i]) * 0x100000001B3ULL;
+
+    return hash ^ (hash >> 32);
+}
+
+/* 블랙잭 카드의 패를 비운다. */
+void ClearHand(Hand *hand) {
+    if (hand == NULL) return;
+
+    hand->length = hand->hardTotal = hand->total = hand->score = hand->flags = 0;
+}
+
+/* 블랙잭 카드의 패에 카드를 한 장 추가하고, 패의 상태를 갱신한다. */
+bool AddHandCard(Hand *hand, Card card) {
+    if (hand == NULL || hand->length >= MAX_HAND_COUNT) return false;
+
+    const int value = cardValues[GET_CARD_INDEX(card)];
+
+    hand->cards[hand->length++] = card;
+    hand->hardTotal += value;
+
+    // 패의 상태는 에이스 여부를 제외하고 매번 새로 계산한다.
+    uint8_t flags = (hand->flags & HF_ACE) | ((value == 1) ? HF_ACE : 0);
+
+    hand->total = hand->hardTotal;
+
+    // 에이스 한 장을 11로 계산해도 21을 넘지 않으면 소프트 핸드이다.
+    if ((flags & HF_ACE) && hand->hardTotal <= BLACKJACK - 10)
+        hand->total += 10, flags |= HF_SOFT;
+
+    if (hand->length == 2) {
+        if (cardValues[GET_CARD_INDEX(hand->cards[0])] == value)
+            flags |= HF_PAIR;
+
+        if (hand->total == BLACKJACK) flags |= HF_BLACKJACK;
+    }
+
+    if (hand->hardTotal > BLACKJACK) flags |= HF_BUST;
+
+    hand->flags = flags;
+
+    if (flags & HF_BUST)
+        hand->score = HAND_SCORE_BUST;
+    else if (flags & HF_BLACKJACK)
+        hand->score = HAND_SCORE_BLACKJACK;
+    else
+        hand->score = hand->total;
+
+    return true;
+}
+
+/* 플레이어와 딜러의 패를 비교하여 게임의 결과를 반환한다. */
+RoundResult GetRoundResult(const Hand *playerHand, const Hand *dealerHand) {
+    return resultTable[playerHand->score][dealerHand->score];
+}
+
+/*
+    `seat`번 이후의 좌석 중에서 인슈어런스를 결정할 첫 번째 좌석을 반환한다.
+
+    블랙잭인 좌석에는 보통 인슈어런스 대신 이븐 머니를 제안하므로 건너뛰며,
+    인슈어런스를 결정할 좌석이 없으면 좌석의 수를 반환한다.
+*/
+static int GetInsuranceSeat(const Table *table, int seat) {
+    while (seat < table->rules.seatCount
+        && (table->playerHands[seat][0].flags & HF_BLACKJACK))
+        seat++;
+
+    return seat;
+}
+
+/* 딜러의 블랙잭 여부를 확인하고, 플레이어의 차례를 시작한다. */
+static void PeekDealerHand(Table *table) {
+    table->state = GS_PLAYER_TURN;
+
+    // 딜러가 블랙잭이면 게임을 바로 끝낸다.
+    if (table->dealerHand.flags & HF_BLACKJACK) {
+        PlayDealerTurn(table);
+
+        return;
+    }
+
+    // 블랙잭인 좌석은 건너뛰고, 카드를 더 받을 수 있는 첫 번째 패부터 진행한다.
+    table->activeSeat = 0, table->activeHand = -1;
+
+    AdvancePlayerHand(table);
+}
+
+/*
+    차례인 좌석에서 진행 중인 패를 두 개의 패로 나눈다.
+
+    나눈 두 패에는 카드를 한 장씩 바로 나눠주며, 에이스를 나눈 경우에는
+    더 이상 카드를 받지 않는다.
+*/
+static void SplitPlayerHand(Table *table) {
+    const int seat = table->activeSeat, index = table->activeHand;
+
+    // 나눈 패는 진행 중인 패의 바로 다음에 끼워 넣는다.
+    for (int i = table->playerHandCounts[seat]; i > index + 1; i--) {
+        table->playerHands[seat][i] = table->playerHands[seat][i - 1];
+        table->playerHandFlags[seat][i] = table->playerHandFlags[seat][i - 1];
+    }
+
+    table->playerHandCounts[seat]++;
+
+    Hand *hands = &table->playerHands[seat][index];
+
+    const Card first = hands[0].cards[0], second = hands[0].cards[1];
+
+    ClearHand(&hands[0]), ClearHand(&hands[1]);
+
+    AddHandCard(&hands[0], first), AddHandCard(&hands[1], second);
+
+    for (int i = 0; i < 2; i++) {
+        table->playerHandFlags[seat][index + i] = PH_SPLIT;
+        table->results[seat][index + i] = RR_NONE;
+
+        table->activeHand = index + i;
+
+        DealTableCard(table, true);
+
+        // 나눈 패의 21은 블랙잭으로 인정하지 않는다.
+        if (hands[i].flags & HF_BLACKJACK)
+            hands[i].flags &= ~HF_BLACKJACK, hands[i].score = hands[i].total;
+    }
+
+    if (GET_CARD_INDEX(first) == 0) {
+        AdvancePlayerHand(table);
+    } else {
+        table->activeHand = index;
+
+        if (hands[0].total >= BLACKJACK) AdvancePlayerHand(table);
+    }
+}
+
+/*
+    카드를 더 받을 수 있는 다음 패로 차례를 넘긴다.
+
+    차례인 좌석의 패를 모두 진행했다면, 다음 좌석의 첫 번째 패로 넘어간다.
+*/
+static void AdvancePlayerHand(Table *table) {
+    const int seatCount = table->rules.seatCount;
+
+    for (int seat = table->activeSeat; seat < seatCount; seat++) {
+        const int handCount = table->playerHandCounts[seat];
+
+        for (int i = (seat == table->activeSeat) ? table->activeHand + 1 : 0;
+            i < handCount; i++) {
+            if (table->playerHands[seat][i].total >= BLACKJACK) continue;
+
+            table->activeSeat = seat, table->activeHand = i;
+
+            return;
+        }
+    }
+
+    // 모든 패를 진행했다면, 마지막 좌석의 마지막 패를 가리킨 채로 딜러의 차례를 진행한다.
+    table->activeSeat = seatCount - 1;
+    table->activeHand = table->playerHandCounts[seatCount - 1] - 1;
+
+    table->state = GS_DEALER_TURN;
+
+    PlayDealerTurn(table);
+}
+
+/* 지난 게임에서 사용한 카드를 모두 연속 셔플 기계에 다시 넣는다. */
+static void ReturnTableCards(Table *table) {
+    Shoe *shoe = &table->shoe;
+
+    for (int seat = -1; seat < table->rules.seatCount; seat++) {
+        const int handCount = (seat < 0) ? 1 : table->playerHandCounts[seat];
+
+        for (int i = 0; i < handCount; i++) {
+            const Hand *hand = (seat < 0)
+                ? &table->dealerHand
+                : &table->playerHands[seat][i];
+
+            for (int j = 0; j < hand->length; j++) {
+                const bool returned = ReturnCsmCard(shoe, hand->cards[j]);
+
+                assert(returned);
+
+                if (!returned) continue;
+
+                shoe->counts.counts[GetCardRank(hand->cards[j])]++;
+                shoe->counts.total++;
+            }
+        }
+    }
+
+    // 연속 셔플 기계 안의 카드 수는 언제나 처음과 같아야 한다.
+    assert(shoe->length == shoe->capacity && shoe->counts.total == shoe->capacity);
+
+    // 공개된 카드가 모두 카드 슈로 돌아갔으므로, 카드 카운팅도 처음부터 다시 한다.
+    ResetCardCount(&table->count, table->rules.deckCount);
+}
+
+/* 딜러의 차례를 진행한다. */
+static void PlayDealerTurn(Table *table) {
+    table->variant->playDealerTurn(table);
+}
+
+/* 주어진 종류의 카드 슈에서 카드를 한 장 뽑는다. */
+static ALWAYS_INLINE bool DealTableCardImpl(Table *table, bool toPlayer, bool continuousShuffle) {
+    Hand *hand = toPlayer
+        ? &table->playerHands[table->activeSeat][table->activeHand]
+        : &table->dealerHand;
+
+    if (hand->length >= MAX_HAND_COUNT) return false;
+
+    if (table->shoe.length <= 0) {
+        // 연속 셔플 기계는 덱의 수를 충분히 늘려 두었으므로, 게임 도중에 비지 않는다.
+        assert(!continuousShuffle);
+
+        // 게임 도중에 카드 슈가 비었다면, 카드 슈를 다시 섞는다.
+        GenerateTableShoe(table);
+    }
+
+    // 카드 슈의 맨 위에 있는 카드를 삭제한다.
+    Card card = continuousShuffle
+        ? TakeCsmCard(&table->shoe, &table->random)
+        : table->shoe.cards[--table->shoe.length];
+
+    table->shoe.counts.counts[GetCardRank(card)]--;
+    table->shoe.counts.total--;
+
+    // 딜러의 두 번째 카드는 딜러의 차례가 되어야 공개된다.
+    if (toPlayer || hand->length != 1) UpdateCardCount(&table->count, card);
+
+    return AddHandCard(hand, card);
+}
+
+/*
+    모든 좌석과 딜러에게 카지노의 순서대로 처음 두 장의 카드를 나눠준다.
+
+    딜러의 왼쪽 좌석부터 한 장씩 돌아가며 나눠준 뒤 딜러가 한 장을 받고,
+    이를 두 번 반복한다.
+*/
+static ALWAYS_INLINE void DealInitialCardsImpl(Table *table, bool continuousShuffle) {
+    for (int i = 0; i < 2; i++) {
+        for (table->activeSeat = 0;
+            table->activeSeat < table->rules.seatCount;
+            table->activeSeat++)
+            DealTableCardImpl(table, true, continuousShuffle);
+
+        DealTableCardImpl(table, false, continuousShuffle);
+    }
+
+    table->activeSeat = 0;
+}
+
+/* 주어진 종류의 카드 슈를 사용하는 블랙잭 테이블을 초기화한다. */
+static ALWAYS_INLINE void ResetTableImpl(Table *table, bool continuousShuffle) {
+    if (continuousShuffle && table->state != GS_INIT) ReturnTableCards(table);
+
+    ClearHand(&table->dealerHand);
+
+    // 나눈 패는 카드를 나눌 때 초기화하므로, 좌석마다 첫 번째 패만 비운다.
+    for (int i = 0; i < table->rules.seatCount; i++) {
+        ClearHand(&table->playerHands[i][0]);
+
+        table->playerHandFlags[i][0] = 0;
+        table->results[i][0] = RR_NONE;
+
+        table->playerHandCounts[i] = 1;
+        table->insured[i] = false;
+        table->payouts[i] = 0.0;
+    }
+
+    table->activeSeat = table->activeHand = 0;
+
+    table->state = GS_INIT;
+    table->result = RR_NONE;
+    table->payout = 0.0;
+
+    // 연속 셔플 기계에는 컷 카드가 없다.
+    if (!continuousShuffle && table->shoe.length <= table->shoe.cutCard)
+        GenerateTableShoe(table);
+}
+
+/* 주어진 규칙으로 블랙잭 테이블에서 선택할 수 있는 행동의 비트마스크를 반환한다. */
+static ALWAYS_INLINE uint8_t GetTableActionsImpl(
+    const Table *table,
+    bool doubleAfterSplit,
+    bool surrender,
+    int splitHandCount
+) {
+    if (table->state == GS_INSURANCE)
+        return (1 << PA_STAND) | (1 << PA_INSURANCE);
+    else if (table->state != GS_PLAYER_TURN)
+        return 0;
+
+    const int seat = table->activeSeat;
+
+    const Hand *hand = &table->playerHands[seat][table->activeHand];
+
+    const uint8_t flags = table->playerHandFlags[seat][table->activeHand];
+
+    uint8_t actions = (1 << PA_STAND);
+
+    if (hand->total < BLACKJACK) actions |= (1 << PA_HIT);
+
+    if (hand->length == 2) {
+        if (hand->total < BLACKJACK
+            && (!(flags & PH_SPLIT) || doubleAfterSplit))
+            actions |= (1 << PA_DOUBLE);
+
+        if ((hand->flags & HF_PAIR)
+            && table->playerHandCounts[seat] < splitHandCount)
+            actions |= (1 << PA_SPLIT);
+
+        // 서렌더는 카드를 나누기 전의 첫 번째 결정으로만 할 수 있다.
+        if (surrender && table->playerHandCounts[seat] == 1)
+            actions |= (1 << PA_SURRENDER);
+    }
+
+    return actions;
+}
+
+/* 주어진 규칙으로 딜러의 차례를 진행하고, 게임의 결과를 정산한다. */
+static ALWAYS_INLINE void PlayDealerTurnImpl(
+    Table *table,
+    bool continuousShuffle,
+    bool hitsSoft17,
+    BlackjackPayout payout
+) {
+    Hand *dealerHand = &table->dealerHand;
+
+    // 딜러의 두 번째 카드를 공개한다.
+    if (dealerHand->length >= 2) UpdateCardCount(&table->count, dealerHand->cards[1]);
+
+    const int seatCount = table->rules.seatCount;
+
+    bool hasLiveHand = false;
+
+    for (int seat = 0; seat < seatCount; seat++)
+        for (int i = 0; i < table->playerHandCounts[seat]; i++)
+            if (!(table->playerHands[seat][i].flags & (HF_BUST | HF_BLACKJACK))
+                && !(table->playerHandFlags[seat][i] & PH_SURRENDERED))
+                hasLiveHand = true;
+
+    /*
+        플레이어에게 버스트, 블랙잭, 서렌더가 아닌 패가 남아있다면, 딜러는
+        17 이상이 될 때까지 카드를 받는다. 규칙에 따라 소프트 17에서도
+        카드를 받는다.
+    */
+    if (hasLiveHand)
+        while (dealerHand->total < DEALER_STAND_TOTAL
+            || (hitsSoft17 && dealerHand->total == DEALER_STAND_TOTAL
+                && (dealerHand->flags & HF_SOFT)))
+            if (!DealTableCardImpl(table, false, continuousShuffle)) break;
+
+    // 인슈어런스는 베팅 금액의 절반을 걸고, 딜러가 블랙잭이면 2배로 돌려받는다.
+    const double insurancePayout = (dealerHand->flags & HF_BLACKJACK) ? 1.0 : -0.5;
+
+    double total = 0.0;
+
+    for (int seat = 0; seat < seatCount; seat++) {
+        double seatTotal = 0.0;
+
+        for (int i = 0; i < table->playerHandCounts[seat]; i++) {
+            const uint8_t flags = table->playerHandFlags[seat][i];
+
+            const RoundResult result = (flags & PH_SURRENDERED)
+                ? RR_SURRENDER
+                : GetRoundResult(&table->playerHands[seat][i], dealerHand);
+
+            table->results[seat][i] = result;
+
+            seatTotal += ((flags & PH_DOUBLED) ? 2.0 : 1.0) * (
+                (result == RR_PLAYER_BLACKJACK)
+                    ? blackjackPayouts[payout]
+                    : resultPayouts[result]
+            );
+        }
+
+        if (table->insured[seat]) seatTotal += insurancePayout;
+
+        table->payouts[seat] = seatTotal;
+
+        total += seatTotal;
+    }
+
+    table->result = table->results[0][0];
+    table->payout = total;
+
+    table->state = GS_ROUND_END;
+}
+
+/* 주어진 규칙으로 블랙잭 테이블에서 게임을 한 판 진행한다. */
+static ALWAYS_INLINE RoundResult PlayTableRoundImpl(
+    Table *table,
+    int standTotal,
+    bool continuousShuffle,
+    bool hitsSoft17,
+    BlackjackPayout payout
+) {
+    ResetTableImpl(table, continuousShuffle);
+
+    DealInitialCardsImpl(table, continuousShuffle);
+
+    // 모든 좌석이 같은 기준으로, 딜러의 왼쪽 좌석부터 차례대로 카드를 받는다.
+    if (!(table->dealerHand.flags & HF_BLACKJACK)) {
+        for (int seat = 0; seat < table->rules.seatCount; seat++) {
+            const Hand *playerHand = &table->playerHands[seat][0];
+
+            table->activeSeat = seat;
+
+            while (playerHand->total < standTotal)
+                if (!DealTableCardImpl(table, true, continuousShuffle)) break;
+        }
+    }
+
+    PlayDealerTurnImpl(table, continuousShuffle, hitsSoft17, payout);
+
+    return table->result;
+}
+
+/* 카드 슈의 종류마다 특수화된 카드 분배 함수들을 정의한다. */
+DEFINE_SHOE_VARIANT(0)
+DEFINE_SHOE_VARIANT(1)
+
+/* 지원하는 모든 규칙 조합마다 특수화된 게임 진행 함수들을 정의한다. */
+FOR_EACH_TABLE_VARIANT(DEFINE_TABLE_VARIANT)
+
+/* 규칙 조합별로 특수화된 게임 진행 함수들. */
+static const TableVariant tableVariants[2][2][2][_BP_COUNT][2][MAX_SPLIT_HAND_COUNT] = {
+    FOR_EACH_TABLE_VARIANT(REGISTER_TABLE_VARIANT)
+};
\ No newline at end of file
@@ -21,10 +21,14 @@
 */
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <time.h>
 
 #include "b021.h"
 
+#include "rlgl.h"
+
 /* | `game` 모듈 상수... | */
 
 /* 블랙잭 카드 덱의 기본 위치. */
@@ -39,6 +43,16 @@ static const Vector2 dealerHandPosition = { 352.0f - 14.0f, 322.0f + 2.0f };
 /* 플레이어 패의 기본 위치. */
 static const Vector2 playerHandPosition = { 25.0f - 14.0f, 322.0f + 2.0f };
 
+/* 플레이어의 행동 이름. */
+static const char *actionNames[_PA_COUNT] = {
+    [PA_STAND] = "STAND",
+    [PA_HIT] = "HIT",
+    [PA_DOUBLE] = "DOUBLE",
+    [PA_SPLIT] = "SPLIT",
+    [PA_SURRENDER] = "SURRENDER",
+    [PA_INSURANCE] = "INSURANCE"
+};
+
 /* | `game` 모듈 변수... | */
 
 /* 블랙잭 보드의 리소스 데이터. */
@@ -47,173 +61,335 @@ static Asset *astBoard;
 /* 블랙잭 카드의 리소스 데이터. */
 static Asset *astCards;
 
-/* 딜러와 플레이어의 패. */
-static Deck dealerHand, playerHand;
+/* 블랙잭 테이블. */
+static Table table;
+
+/* 블랙잭 테이블의 게임을 기록하는 리플레이 기록기. */
+static ReplayWriter replayWriter;
+
+/* 빈 좌석에 앉히는 봇 플레이어. */
+static BotPolicy botPolicy;
+
+/* 좌석별로 앉은 봇 플레이어. (플레이어의 좌석은 `NULL`이다.) */
+static const BotPolicy *seatBots[MAX_SEAT_COUNT];
+
+/* 블랙잭 카드 덱에 쌓인 카드들의 랜덤 값. */
+static float deckOffsets[MAX_CARD_COUNT];
+
+/* 카드들의 랜덤 값을 생성할 때의 카드 슈를 섞은 횟수. */
+static int deckShuffleCount;
+
+/* 블랙잭 보드와 카드 덱을 미리 그려 놓은 렌더 텍스처. */
+static RenderTexture2D deckLayer;
+
+/* 렌더 텍스처에 그려진 카드 덱의 높이. (`-1`이면 아직 그려지지 않았다.) */
+static int deckLayerCount = -1;
+
+/* 렌더 텍스처에 그려진 카드 덱의 카드 슈를 섞은 횟수. */
+static int deckLayerShuffleCount;
+
+/* 딜러와 플레이어가 진행 중인 패에 있는 카드들의 화면 표시 상태. */
+static CardState dealerCardStates[MAX_HAND_COUNT], playerCardStates[MAX_HAND_COUNT];
+
+/* 딜러와 플레이어의 패에 있는 카드들의 사각형 배열. */
+static CardBatch dealerBatch = { .dirty = true }, playerBatch = { .dirty = true };
+
+/* 딜러와 플레이어의 패의 합계를 보여주는 텍스트 레이블. */
+static TextLabel dealerTotalLabel, playerTotalLabel;
 
-/* 블랙잭 카드 덱. */
-static Deck deck;
+/* 플레이어에게 추천하는 행동을 보여주는 텍스트 레이블. */
+static TextLabel hintLabel;
 
-/* 블랙잭 게임의 상태. */
-static GameState gameState;
+/* 플레이어에게 행동을 추천하기 위한 게임 전략 계산기. */
+static Solver solver;
+
+/* 플레이어에게 추천하는 행동. */
+static SolverResult hint;
+
+/* 플레이어가 카드를 한 장 더 받았을 때 버스트될 확률. */
+static double bustProbability;
+
+/* 플레이어가 인슈어런스를 걸었을 때의 기댓값. */
+static double insuranceEv;
 
 /* 게임 플레이 화면의 결과값. */
 static int result;
 
 /* | `game` 모듈 함수... | */
 
-/* 덱에서 카드를 한 장 뽑는다. */
-static void DealCard(bool toPlayer);
+/* 블랙잭 카드를 `batch`에 추가한다. */
+static void AddCardToBatch(CardBatch *batch, Card card, CardState state, Vector2 position);
+
+/* 플레이어의 패 하나에 속한 카드들을 `batch`에 추가한다. */
+static void AddPlayerHandToBatch(
+    CardBatch *batch, 
+    const Hand *hand, 
+    Vector2 handPosition, 
+    bool active
+);
+
+/* 딜러의 패에 있는 카드들의 사각형을 다시 계산한다. */
+static void BuildDealerBatch(Vector2 position);
+
+/* 플레이어의 패에 있는 카드들의 사각형을 다시 계산한다. */
+static void BuildPlayerBatch(Vector2 position);
 
 /* 블랙잭 보드를 그린다. */
 static void DrawBoard(void);
 
 /* 블랙잭 카드를 그린다. */
-static void DrawCard(Card *card, Vector2 position);
+static void DrawCard(Card card, CardState state, Vector2 position, float offset);
+
+/* `batch`에 있는 블랙잭 카드들을 한 번에 그린다. */
+static void DrawCardBatch(const CardBatch *batch);
 
 /* 블랙잭 카드 덱을 그린다. */
 static void DrawDeck(Vector2 position);
 
+/* 블랙잭 보드와 카드 덱을 미리 그려 놓은 렌더 텍스처를 화면에 그린다. */
+static void DrawDeckLayer(void);
+
 /* 딜러의 패를 그린다. */
 static void DrawDealerHand(Vector2 position);
 
 /* 플레이어의 패를 그린다.*/
 static void DrawPlayerHand(Vector2 position);
 
-/* 블랙잭 카드 덱을 생성한다. */
-static void GenerateDeck(void);
+/* 블랙잭 카드 텍스처에서 카드의 사각형을 반환한다. */
+static Rectangle GetCardSource(Card card, CardState state);
+
+/* 블랙잭 카드 덱에 쌓아서 그릴 카드의 수를 반환한다. */
+static int GetDeckLayerCount(void);
+
+/* `seat + 1`번째 좌석에 있는 플레이어의 `index + 1`번째 패의 위치를 반환한다. */
+static Vector2 GetPlayerHandPosition(Vector2 position, int seat, int index);
 
 /* 마우스 이벤트를 처리한다. */
 static void HandleMouseEvents(void);
 
+/* 빈 좌석에 봇 플레이어를 앉힌다. */
+static void InitSeatBots(const Rules *rules);
+
+/* 봇 플레이어가 행동할 차례인지 확인한다. */
+static bool IsBotTurn(void);
+
 /* 게임의 상태를 변경한다. */
-static void TakeTurn(bool hit);
+static void TakeTurn(PlayerAction action);
 
 /* 게임을 초기화한다. */
 static void ResetGame(void);
 
+/* 카드 덱의 높이나 카드들의 랜덤 값이 바뀌었다면, 렌더 텍스처를 다시 그린다. */
+static void UpdateDeckLayer(void);
+
+/* 플레이어에게 추천하는 행동을 갱신한다. */
+static void UpdateHint(void);
+
 /* 게임 플레이 장면을 초기화한다. */
 void InitGameScene(void) {
     astBoard = GetAsset(0);
     astCards = GetAsset(1);
 
+    if (deckLayer.id == 0) deckLayer = LoadRenderTexture(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    InitTextLabel(&dealerTotalLabel, GetFontDefault(), 20.0f, 2.0f);
+    InitTextLabel(&playerTotalLabel, GetFontDefault(), 20.0f, 2.0f);
+    InitTextLabel(&hintLabel, GetFontDefault(), 20.0f, 2.0f);
+
+    const uint64_t seed = (uint64_t) time(NULL);
+
+    Rules rules = GetDefaultRules();
+
+    rules.seatCount = TABLE_SEAT_COUNT;
+
+    InitTable(&table, &rules, seed, 0);
+
+    if (!OpenReplayWriter(&replayWriter, REPLAY_FILE_NAME, &table, seed, 0))
+        TraceLog(LOG_WARNING, "GAME: Failed to create replay log '%s'", REPLAY_FILE_NAME);
+
+    InitSolver(&solver);
+
+    InitSeatBots(&table.rules);
+
     ResetGame();
 }
 
 /* 게임 플레이 장면을 업데이트한다. */
 void UpdateGameScene(void) {
+    // 봇 플레이어의 차례에는 플레이어의 입력 대신 봇 플레이어가 한 번씩 행동한다.
+    if (IsBotTurn()) TakeTurn(GetSeatBotAction(&table, (void *) seatBots));
 #ifdef _DEBUG
     /* TODO: 창 및 버튼 추가... */
-
-    if (IsKeyPressed(KEY_Q) || IsKeyPressed(KEY_W))
-        TakeTurn(IsKeyPressed(KEY_Q));
+    else if (IsKeyPressed(KEY_Q)) TakeTurn(PA_HIT);
+    else if (IsKeyPressed(KEY_W)) TakeTurn(PA_STAND);
+    else if (IsKeyPressed(KEY_E)) TakeTurn(PA_DOUBLE);
+    else if (IsKeyPressed(KEY_A)) TakeTurn(PA_SPLIT);
+    else if (IsKeyPressed(KEY_S)) TakeTurn(PA_SURRENDER);
+    else if (IsKeyPressed(KEY_D)) TakeTurn(PA_INSURANCE);
 
     if (IsKeyPressed(KEY_R)) ResetGame();
 #endif
 
     // 마우스 이벤트를 처리한다.
+    BeginProfilePhase(PP_MOUSE);
+
     HandleMouseEvents();
 
+    EndProfilePhase(PP_MOUSE);
+
     {
-        // 블랙잭 보드를 그린다.
-        DrawBoard();
+        // 블랙잭 보드와 카드 덱을 그린다.
+        BeginProfilePhase(PP_BOARD);
+
+        DrawDeckLayer();
 
-        // 블랙잭 카드 덱을 그린다.
-        DrawDeck(deckPosition);
+        EndProfilePhase(PP_BOARD);
+
+        BeginProfilePhase(PP_HANDS);
 
         // 플레이어의 패를 그린다.
         DrawPlayerHand(playerHandPosition);
 
         // 딜러의 패를 그린다.
         DrawDealerHand(dealerHandPosition);
+
+        EndProfilePhase(PP_HANDS);
         
 #ifdef _DEBUG
-        // FPS 카운터를 그린다.
-        DrawFPS(8, 8);
+        // 프레임 구간별 시간을 그린다.
+        DrawProfiler((Vector2) { 8.0f, 8.0f });
 #endif
     }
+
+    // 봇 플레이어가 아직 행동하고 있다면, 입력 이벤트가 없어도 다음 프레임을 그린다.
+    if (IsBotTurn()) RequestRedraw();
 }
 
 /* 게임 플레이 장면을 종료한다. */
 int FinishGameScene(void) {
+    // 장면을 다시 초기화하면 덱 레이어를 새로 만들고 처음부터 다시 그린다.
+    if (deckLayer.id != 0) UnloadRenderTexture(deckLayer);
+
+    deckLayer = (RenderTexture2D) { 0 };
+    deckLayerCount = -1;
+
+    // 장면을 다시 초기화하면 리플레이 기록 파일을 새로 만든다.
+    CloseReplayWriter(&replayWriter);
+
     return result;
 }
 
-/* 덱에서 카드를 한 장 뽑는다. */
-static void DealCard(bool toPlayer) {
-    if (deck.length <= 0) {
-        TraceLog(
-            LOG_INFO, 
-            "Unable to deal a card because the deck is empty"
+/* 블랙잭 카드를 `batch`에 추가한다. */
+static void AddCardToBatch(CardBatch *batch, Card card, CardState state, Vector2 position) {
+    if (batch->length >= MAX_BATCH_CARD_COUNT) return;
+
+    const Texture2D texture = astCards->data.texture;
+
+    const Rectangle source = GetCardSource(card, state);
+
+    // 마우스가 닿은 카드는 위로 올려서 그린다.
+    if (state == CS_FRONT_HOVER || state == CS_BACK_HOVER)
+        position.y -= 0.75f * CARD_HEIGHT;
+
+    batch->sources[batch->length] = (Rectangle) {
+        .x = source.x / texture.width,
+        .y = source.y / texture.height,
+        .width = source.width / texture.width,
+        .height = source.height / texture.height
+    };
+
+    batch->dests[batch->length] = (Rectangle) {
+        .x = position.x,
+        .y = position.y,
+        .width = 2.0f * CARD_WIDTH,
+        .height = 2.0f * CARD_HEIGHT
+    };
+
+    batch->length++;
+}
+
+/* 플레이어의 패 하나에 속한 카드들을 `batch`에 추가한다. */
+static void AddPlayerHandToBatch(
+    CardBatch *batch, 
+    const Hand *hand, 
+    Vector2 handPosition, 
+    bool active
+) {
+    for (int j = 0; j < hand->length; j++)
+        AddCardToBatch(
+            batch,
+            hand->cards[j],
+            active ? playerCardStates[j] : CS_FRONT_NORMAL,
+            (Vector2) { 
+                handPosition.x + (0.25f * CARD_WIDTH) * j,
+                handPosition.y
+            }
         );
-        
-        return;
-    } else if ((toPlayer && playerHand.length >= MAX_HAND_COUNT)
-        || (!toPlayer && dealerHand.length >= MAX_HAND_COUNT)) {
-        TraceLog(
-            LOG_INFO, 
-            "Unable to deal a card because %s's hand is full",
-            toPlayer ? "the player" : "the dealer"
+}
+
+/* 딜러의 패에 있는 카드들의 사각형을 다시 계산한다. */
+static void BuildDealerBatch(Vector2 position) {
+    dealerBatch.length = 0;
+
+    for (int i = 0; i < table.dealerHand.length; i++)
+        AddCardToBatch(
+            &dealerBatch,
+            table.dealerHand.cards[i],
+            dealerCardStates[i],
+            (Vector2) { 
+                position.x + (0.25f * CARD_WIDTH) * i,
+                position.y
+            }
         );
 
-        return;
-    }
+    dealerBatch.dirty = false;
+}
 
-    // 덱의 맨 위에 있는 카드를 삭제한다.
-    Card top = deck.cards[--deck.length];
+/* 플레이어의 패에 있는 카드들의 사각형을 다시 계산한다. */
+static void BuildPlayerBatch(Vector2 position) {
+    const int activeSeat = table.activeSeat, seatCount = table.rules.seatCount;
 
-    top.offset = deck.cards[deck.length - 1].offset = 0.0f;
+    playerBatch.length = 0;
 
-    TraceLog(
-        LOG_INFO, 
-        "Dealing card #%d to %s",
-        toPlayer ? playerHand.length : dealerHand.length,
-        toPlayer ? "the player" : "the dealer"
-    );
+    // 진행 중인 패가 맨 위에 보이도록, 차례인 좌석과 진행 중인 패를 마지막에 추가한다.
+    for (int s = 0; s < seatCount; s++) {
+        const int seat = (s < activeSeat)
+            ? s
+            : (s < seatCount - 1) ? s + 1 : activeSeat;
 
-    if (toPlayer) {
-        // 플레이어는 자신의 패를 다 볼 수 있다.
-        top.state = CS_FRONT_NORMAL;
+        const int seatHandCount = table.playerHandCounts[seat];
 
-        playerHand.cards[playerHand.length++] = top;
-        playerHand.total += (top.index < 10) ? top.index + 1 : 10;
-    } else {
-        // 딜러의 첫 번째 카드만 보여준다.
-        top.state = (dealerHand.length == 0) ? CS_FRONT_NORMAL : CS_BACK_NORMAL;
+        const int activeIndex = (seat == activeSeat) ? table.activeHand : seatHandCount - 1;
 
-        dealerHand.cards[dealerHand.length++] = top;
-        dealerHand.total += (top.index < 10) ? top.index + 1 : 10;
+        for (int i = 0; i < seatHandCount; i++) {
+            const int index = (i < activeIndex)
+                ? i
+                : (i < seatHandCount - 1) ? i + 1 : activeIndex;
+
+            AddPlayerHandToBatch(
+                &playerBatch,
+                &table.playerHands[seat][index],
+                GetPlayerHandPosition(position, seat, index),
+                seat == activeSeat && index == activeIndex
+            );
+        }
     }
+
+    playerBatch.dirty = false;
 }
 
 /* 블랙잭 보드를 그린다. */
 static void DrawBoard(void) {
     ClearBackground(BLACK);
 
-    DrawTextureV(astBoard->data.texture, (Vector2) { 0.0f }, WHITE);
+    DrawTextureV(astBoard->data.texture, (Vector2) { 0.0f, 0.0f }, WHITE);
 }
 
 /* 블랙잭 카드를 그린다. */
-static void DrawCard(Card *card, Vector2 position) {
-    if (card == NULL) return;
+static void DrawCard(Card card, CardState state, Vector2 position, float offset) {
+    Rectangle source = GetCardSource(card, state);
 
-    Rectangle source = {
-        .x = card->index * CARD_WIDTH,
-        .y = card->suit * CARD_HEIGHT,
-        .width = CARD_WIDTH,
-        .height = CARD_HEIGHT
-    };
-
-    // 카드가 뒷면인 경우?
-    if (card->state == CS_BACK_NORMAL || card->state == CS_BACK_HOVER) {
-        source.x = MAX_CARD_NUMBER * CARD_WIDTH;
-        source.y = SU_DIAMOND * CARD_HEIGHT;
-    }
-
-    Card *top = &deck.cards[deck.length - 1];
-
-    // 이 카드가 맨 위에 있지 않을 경우?
-    if (top->suit != card->suit || top->index != card->index)
-        source.height -= card->offset;
+    source.height -= offset;
 
     const Rectangle dest = {
         .x = position.x,
@@ -226,190 +402,457 @@ static void DrawCard(Card *card, Vector2 position) {
         astCards->data.texture,
         source,
         dest,
-        (Vector2) { 0.0f },
+        (Vector2) { 0.0f, 0.0f },
         0.0f,
         WHITE
     );
 }
 
+/* `batch`에 있는 블랙잭 카드들을 한 번에 그린다. */
+static void DrawCardBatch(const CardBatch *batch) {
+    if (batch->length <= 0) return;
+
+    // 렌더 배치에 카드들이 모두 들어갈 자리가 없다면, 렌더 배치를 먼저 비운다.
+    rlCheckRenderBatchLimit(4 * batch->length);
+
+    rlSetTexture(astCards->data.texture.id);
+
+    rlBegin(RL_QUADS);
+
+    rlColor4ub(WHITE.r, WHITE.g, WHITE.b, WHITE.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+
+    // `DrawTexturePro()`와 같은 순서로 꼭짓점을 넘긴다.
+    for (int i = 0; i < batch->length; i++) {
+        const Rectangle source = batch->sources[i], dest = batch->dests[i];
+
+        rlTexCoord2f(source.x, source.y);
+        rlVertex2f(dest.x, dest.y);
+
+        rlTexCoord2f(source.x, source.y + source.height);
+        rlVertex2f(dest.x, dest.y + dest.height);
+
+        rlTexCoord2f(source.x + source.width, source.y + source.height);
+        rlVertex2f(dest.x + dest.width, dest.y + dest.height);
+
+        rlTexCoord2f(source.x + source.width, source.y);
+        rlVertex2f(dest.x + dest.width, dest.y);
+    }
+
+    rlEnd();
+
+    rlSetTexture(0);
+}
+
 /* 블랙잭 카드 덱을 그린다. */
 static void DrawDeck(Vector2 position) {
-    for (int i = 0; i < deck.length; i++) {
-        DrawCard(&deck.cards[i], position);
+    const Shoe *shoe = &table.shoe;
+
+    if (shoe->length <= 0) return;
+
+    const int layerCount = GetDeckLayerCount();
+
+    for (int i = 0; i < layerCount; i++) {
+        // 맨 위에 있는 카드는 온전하게 그린다.
+        DrawCard(
+            shoe->cards[shoe->length - 1],
+            CS_BACK_NORMAL,
+            position,
+            (i != layerCount - 1) ? deckOffsets[i] : 0.0f
+        );
 
         position.y -= 0.8f;
     }
 }
 
+/* 블랙잭 보드와 카드 덱을 미리 그려 놓은 렌더 텍스처를 화면에 그린다. */
+static void DrawDeckLayer(void) {
+    ClearBackground(BLACK);
+
+    /*
+        카드 테두리처럼 반투명한 부분은 렌더 텍스처의 알파 값이 1보다 작게 기록되므로,
+        알파 값을 무시하고 색상만 그대로 옮기도록 `BLEND_ADD_COLORS`로 그린다.
+    */
+    BeginBlendMode(BLEND_ADD_COLORS);
+
+    // 렌더 텍스처는 위아래가 뒤집혀 있으므로, 높이를 음수로 지정한다.
+    DrawTextureRec(
+        deckLayer.texture,
+        (Rectangle) {
+            .width = deckLayer.texture.width,
+            .height = -deckLayer.texture.height
+        },
+        (Vector2) { 0.0f, 0.0f },
+        WHITE
+    );
+
+    EndBlendMode();
+}
+
 /* 딜러의 패를 그린다. */
 static void DrawDealerHand(Vector2 position) {
-    DrawTextEx(
-        GetFontDefault(),
-        gameState == GS_DEALER_TURN 
-            ? TextFormat("TOTAL : %d", dealerHand.total)
-            : TextFormat("TOTAL : ?"),
+    if (dealerTotalLabel.dirty) {
+        SetTextLabel(
+            &dealerTotalLabel,
+            table.state >= GS_DEALER_TURN 
+                ? TextFormat("TOTAL : %d", table.dealerHand.total)
+                : TextFormat("TOTAL : ?")
+        );
+    }
+
+    DrawTextLabel(
+        &dealerTotalLabel,
         (Vector2) {
             dealerHandPosition.x + 9.0f,
             dealerHandPosition.y - 32.0f
         },
-        20.0f,
-        2.0f,
         WHITE
     );
 
-    for (int i = 0; i < dealerHand.length; i++)
-        DrawCard(
-            &dealerHand.cards[i], 
-            (Vector2) { 
-                position.x + (0.25f * CARD_WIDTH) * i,
-                position.y + (
-                    (dealerHand.cards[i].state == CS_FRONT_HOVER
-                        || dealerHand.cards[i].state == CS_BACK_HOVER)
-                        ? -0.75f * CARD_HEIGHT
-                        : 0.0f
-                )
-            }
-        );
+    if (dealerBatch.dirty) BuildDealerBatch(position);
+
+    DrawCardBatch(&dealerBatch);
 }
 
 /* 플레이어의 패를 그린다.*/
 static void DrawPlayerHand(Vector2 position) {
-    DrawTextEx(
-        GetFontDefault(),
-        TextFormat("TOTAL : %d", playerHand.total),
+    const int activeSeat = table.activeSeat, handCount = table.playerHandCounts[activeSeat];
+
+    const Hand *activeHand = &table.playerHands[activeSeat][table.activeHand];
+
+    // 게임의 상태가 바뀌었을 때만 문자열을 다시 만든다.
+    if (playerTotalLabel.dirty) {
+        SetTextLabel(
+            &playerTotalLabel,
+            (table.rules.seatCount > 1)
+                ? TextFormat(
+                    "TOTAL : %d (SEAT %d, %d / %d)",
+                    activeHand->total,
+                    activeSeat + 1,
+                    table.activeHand + 1,
+                    handCount
+                )
+                : (handCount > 1)
+                    ? TextFormat(
+                        "TOTAL : %d (%d / %d)",
+                        activeHand->total,
+                        table.activeHand + 1,
+                        handCount
+                    )
+                    : TextFormat("TOTAL : %d", activeHand->total)
+        );
+    }
+
+    DrawTextLabel(
+        &playerTotalLabel,
         (Vector2) {
             playerHandPosition.x + 9.0f,
             playerHandPosition.y - 32.0f
         },
-        20.0f,
-        2.0f,
         WHITE
     );
 
-    for (int i = 0; i < playerHand.length; i++)
-        DrawCard(
-            &playerHand.cards[i], 
-            (Vector2) { 
-                position.x + (0.25f * CARD_WIDTH) * i,
-                position.y + (
-                    (playerHand.cards[i].state == CS_FRONT_HOVER
-                        || playerHand.cards[i].state == CS_BACK_HOVER)
-                        ? -0.75f * CARD_HEIGHT
-                        : 0.0f
-                )
-            }
+    if (table.state == GS_INSURANCE || table.state == GS_PLAYER_TURN) {
+        if (hintLabel.dirty) {
+            SetTextLabel(
+                &hintLabel,
+                (table.state == GS_INSURANCE)
+                    ? TextFormat("HINT : INSURANCE (%+.3f)", insuranceEv)
+                    : TextFormat(
+                        "HINT : %s (%+.3f), BUST : %.1f%%",
+                        actionNames[hint.best],
+                        hint.ev[hint.best],
+                        100.0 * bustProbability
+                    )
+            );
+        }
+
+        DrawTextLabel(
+            &hintLabel,
+            (Vector2) {
+                playerHandPosition.x + 9.0f,
+                playerHandPosition.y - 56.0f
+            },
+            WHITE
         );
+    }
+
+    if (playerBatch.dirty) BuildPlayerBatch(position);
+
+    DrawCardBatch(&playerBatch);
 }
 
-/* 블랙잭 카드 덱을 생성한다. */
-static void GenerateDeck(void) {
-    deck.length = MAX_CARD_COUNT;
-
-    for (int y = 0; y < _SU_COUNT; y++)
-        for (int x = 0; x < MAX_CARD_NUMBER; x++) {
-            deck.cards[y * MAX_CARD_NUMBER + x] = (Card) {
-                .suit = y,
-                .index = x,
-                .offset = 0.4f * GetRandomValue(4, 8),
-                .state = CS_BACK_NORMAL
-            };
-        }
+/* 블랙잭 카드 텍스처에서 카드의 사각형을 반환한다. */
+static Rectangle GetCardSource(Card card, CardState state) {
+    // 카드가 뒷면인 경우?
+    if (state == CS_BACK_NORMAL || state == CS_BACK_HOVER)
+        return (Rectangle) {
+            .x = MAX_CARD_NUMBER * CARD_WIDTH,
+            .y = SU_DIAMOND * CARD_HEIGHT,
+            .width = CARD_WIDTH,
+            .height = CARD_HEIGHT
+        };
 
-    /* https://en.wikipedia.org/wiki/Fisher%E2%80%93Yates_shuffle */
+    return (Rectangle) {
+        .x = GET_CARD_INDEX(card) * CARD_WIDTH,
+        .y = GET_CARD_SUIT(card) * CARD_HEIGHT,
+        .width = CARD_WIDTH,
+        .height = CARD_HEIGHT
+    };
+}
 
-    for (int i = MAX_CARD_COUNT - 1; i >= 1; i--) {
-        int j = GetRandomValue(0, MAX_CARD_COUNT - 1);
+/* 블랙잭 카드 덱에 쌓아서 그릴 카드의 수를 반환한다. */
+static int GetDeckLayerCount(void) {
+    const Shoe *shoe = &table.shoe;
 
-        int tempSuit = deck.cards[i].suit;
-        int tempIndex = deck.cards[i].index;
+    if (shoe->length <= 0) return 0;
 
-        deck.cards[i].suit = deck.cards[j].suit;
-        deck.cards[i].index = deck.cards[j].index;
+    // 카드 슈의 남은 카드 수에 비례하여, 최대 한 덱 높이만큼 카드를 쌓는다.
+    return (shoe->length * MAX_CARD_COUNT + shoe->capacity - 1) / shoe->capacity;
+}
 
-        deck.cards[j].suit = tempSuit;
-        deck.cards[j].index = tempIndex;
-    }
+/* `seat + 1`번째 좌석에 있는 플레이어의 `index + 1`번째 패의 위치를 반환한다. */
+static Vector2 GetPlayerHandPosition(Vector2 position, int seat, int index) {
+    // 좌석들은 딜러의 패 왼쪽 공간을 나눠서 사용하고, 좌석의 패들은 좌석의 공간을 다시 나눈다.
+    const float seatSpacing = (dealerHandPosition.x - playerHandPosition.x)
+        / table.rules.seatCount;
+
+    const float spacing = seatSpacing / table.playerHandCounts[seat];
 
-    TraceLog(LOG_INFO, "GAME: Generated a new deck successfully");
+    return (Vector2) {
+        position.x + seatSpacing * seat + spacing * index,
+        position.y
+    };
 }
 
 /* 마우스 이벤트를 처리한다. */
 static void HandleMouseEvents(void) {
-    for (int i = 0; i < playerHand.length; i++) {
+    const Hand *activeHand = &table.playerHands[table.activeSeat][table.activeHand];
+
+    const Vector2 activeHandPosition = GetPlayerHandPosition(
+        playerHandPosition,
+        table.activeSeat,
+        table.activeHand
+    );
+
+    for (int i = 0; i < activeHand->length; i++) {
         Rectangle aabb = {
-            .x = playerHandPosition.x + (0.274f * CARD_WIDTH) * (i + 1),
-            .y = playerHandPosition.y,
-            .width = (i != playerHand.length - 1) 
+            .x = activeHandPosition.x + (0.274f * CARD_WIDTH) * (i + 1),
+            .y = activeHandPosition.y,
+            .width = (i != activeHand->length - 1) 
                 ? 0.25f * CARD_WIDTH 
                 : 1.35f * CARD_WIDTH,
             .height = 2.0f * CARD_HEIGHT
         };
 
-        playerHand.cards[i].state = CheckCollisionPointRec(GetMousePosition(), aabb) 
+        const CardState state = CheckCollisionPointRec(GetMousePosition(), aabb) 
             ? CS_FRONT_HOVER
             : CS_FRONT_NORMAL;
+
+        // 마우스가 닿은 카드가 바뀔 때만 카드들의 사각형을 다시 계산한다.
+        if (playerCardStates[i] != state) {
+            playerCardStates[i] = state;
+
+            playerBatch.dirty = true;
+        }
     }
 
-    for (int i = 0; i < dealerHand.length; i++) {
+    for (int i = 0; i < table.dealerHand.length; i++) {
         Rectangle aabb = {
             .x = dealerHandPosition.x + (0.274f * CARD_WIDTH) * (i + 1),
             .y = dealerHandPosition.y,
-            .width = (i != dealerHand.length - 1)
+            .width = (i != table.dealerHand.length - 1)
                 ? 0.25f * CARD_WIDTH 
                 : 1.35f * CARD_WIDTH,
             .height = 2.0f * CARD_HEIGHT
         };
 
-        if (CheckCollisionPointRec(GetMousePosition(), aabb)) {
-            if (dealerHand.cards[i].state == CS_FRONT_NORMAL) 
-                dealerHand.cards[i].state = CS_FRONT_HOVER;
-            else if (dealerHand.cards[i].state == CS_BACK_NORMAL)
-                dealerHand.cards[i].state = CS_BACK_HOVER;
-        } else {
-            if (dealerHand.cards[i].state == CS_FRONT_HOVER) 
-                dealerHand.cards[i].state = CS_FRONT_NORMAL;
-            else if (dealerHand.cards[i].state == CS_BACK_HOVER)
-                dealerHand.cards[i].state = CS_BACK_NORMAL;
+        // 딜러의 차례가 오기 전까지는 딜러의 첫 번째 카드만 보여준다.
+        const bool hidden = (i > 0 && table.state < GS_DEALER_TURN);
+
+        CardState state;
+
+        if (CheckCollisionPointRec(GetMousePosition(), aabb))
+            state = hidden ? CS_BACK_HOVER : CS_FRONT_HOVER;
+        else
+            state = hidden ? CS_BACK_NORMAL : CS_FRONT_NORMAL;
+
+        if (dealerCardStates[i] != state) {
+            dealerCardStates[i] = state;
+
+            dealerBatch.dirty = true;
         }
     }
 }
 
+/*
+    빈 좌석에 봇 플레이어를 앉힌다.
+
+    규칙이 같은 기본 전략표를 불러올 수 있으면 기본 전략을 따르는 봇
+    플레이어를, 그렇지 않으면 버스트되지 않게 행동하는 봇 플레이어를 앉힌다.
+*/
+static void InitSeatBots(const Rules *rules) {
+    static StrategyChart charts[MAX_CHART_COUNT];
+
+    const int chartCount = LoadStrategyCharts(CHART_FILE_NAME, charts, MAX_CHART_COUNT);
+
+    const StrategyChart *chart = FindStrategyChart(charts, chartCount, rules);
+
+    if (chart != NULL) {
+        InitBotPolicy(&botPolicy, BT_BASIC_STRATEGY, chart);
+    } else {
+        InitBotPolicy(&botPolicy, BT_NEVER_BUST, NULL);
+
+        if (rules->seatCount > 1)
+            TraceLog(
+                LOG_WARNING,
+                "GAME: Failed to find a strategy chart in '%s', bots will never bust",
+                CHART_FILE_NAME
+            );
+    }
+
+    for (int i = 0; i < MAX_SEAT_COUNT; i++)
+        seatBots[i] = (i != TABLE_PLAYER_SEAT) ? &botPolicy : NULL;
+}
+
+/* 봇 플레이어가 행동할 차례인지 확인한다. */
+static bool IsBotTurn(void) {
+    return (table.state == GS_INSURANCE || table.state == GS_PLAYER_TURN)
+        && seatBots[table.activeSeat] != NULL;
+}
+
 /* 게임의 상태를 변경한다. */
-static void TakeTurn(bool hit) {
-    if (gameState == GS_PLAYER_TURN && !hit)
-        gameState = GS_DEALER_TURN;
-    
-    switch (gameState) {
-        case GS_INIT:
-            for (int i = 0; i < 2; i++)
-                DealCard(true), DealCard(false);
-            
-            gameState = GS_PLAYER_TURN;
+static void TakeTurn(PlayerAction action) {
+    const GameState previousState = table.state;
+
+    if (!TakeTableTurn(&table, action)) return;
 
-            break;
+    WriteReplayEvent(&replayWriter, action);
 
-        case GS_PLAYER_TURN:
-            DealCard(true);
+    RequestRedraw();
 
-            if (playerHand.total >= BLACKJACK)
-                TakeTurn(false);
+    // 카드를 받거나 차례가 바뀌었으므로, 카드들의 사각형과 문자열을 다시 만든다.
+    dealerBatch.dirty = playerBatch.dirty = true;
 
-            break;
+    dealerTotalLabel.dirty = playerTotalLabel.dirty = hintLabel.dirty = true;
 
-        case GS_DEALER_TURN:
-            for (int i = 0; i < dealerHand.length; i++)
-                dealerHand.cards[i].state = CS_FRONT_NORMAL;
+    UpdateDeckLayer();
 
-            break;
+    UpdateHint();
+
+    if (previousState != GS_ROUND_END && table.state == GS_ROUND_END) {
+        WriteReplayOutcome(&replayWriter, &table);
+
+        TraceLog(
+            LOG_INFO,
+            "GAME: Round finished (player: %d, dealer: %d, result: %s, payout: %+.1f)",
+            table.playerHands[0][0].total,
+            table.dealerHand.total,
+            (table.result == RR_PLAYER_BLACKJACK)
+                ? "player blackjack"
+                : (table.result == RR_PLAYER_WIN)
+                    ? "player wins"
+                    : (table.result == RR_DEALER_WIN) 
+                        ? "dealer wins"
+                        : (table.result == RR_SURRENDER) ? "surrender" : "push",
+            table.payout
+        );
     }
 }
 
 /* 게임을 초기화한다. */
 static void ResetGame(void) {
-    playerHand.length = playerHand.total = 0;
-    dealerHand.length = dealerHand.total = 0;
+    WriteReplayEvent(&replayWriter, RE_RESET);
+
+    ResetTable(&table);
+
+    RequestRedraw();
+
+    dealerBatch.dirty = playerBatch.dirty = true;
+
+    dealerTotalLabel.dirty = playerTotalLabel.dirty = hintLabel.dirty = true;
+
+    if (deckShuffleCount != table.shoe.shuffleCount) {
+        for (int i = 0; i < MAX_CARD_COUNT; i++)
+            deckOffsets[i] = 0.4f * GetRandomValue(4, 8);
+
+        deckShuffleCount = table.shoe.shuffleCount;
+
+        TraceLog(
+            LOG_INFO,
+            "GAME: Shuffled a new %d-deck shoe successfully",
+            table.rules.deckCount
+        );
+    }
+
+    UpdateDeckLayer();
+}
+
+/* 카드 덱의 높이나 카드들의 랜덤 값이 바뀌었다면, 렌더 텍스처를 다시 그린다. */
+static void UpdateDeckLayer(void) {
+    const int layerCount = GetDeckLayerCount();
+
+    /*
+        카드 덱은 항상 뒷면만 보이므로, 카드를 받거나 카드 슈를 새로 섞어서
+        쌓인 높이나 카드들의 랜덤 값이 바뀔 때만 다시 그리면 된다.
+    */
+    if (deckLayerCount == layerCount && deckLayerShuffleCount == deckShuffleCount)
+        return;
+
+    BeginProfilePhase(PP_DECK);
+
+    BeginTextureMode(deckLayer);
+
+    DrawBoard();
+    DrawDeck(deckPosition);
+
+    EndTextureMode();
+
+    EndProfilePhase(PP_DECK);
+
+    deckLayerCount = layerCount;
+    deckLayerShuffleCount = deckShuffleCount;
+}
+
+/* 플레이어에게 추천하는 행동을 갱신한다. */
+static void UpdateHint(void) {
+    if (table.state != GS_INSURANCE && table.state != GS_PLAYER_TURN) return;
+
+    RankCounts counts;
+
+    GetShoeRankCounts(&table.shoe, &counts);
+
+    // 플레이어는 딜러의 두 번째 카드를 모르므로, 남은 카드로 계산한다.
+    for (int i = 1; i < table.dealerHand.length; i++)
+        counts.counts[GetCardRank(table.dealerHand.cards[i])]++, counts.total++;
+
+    // 인슈어런스는 베팅 금액의 절반을 걸고, 딜러가 블랙잭이면 2배로 돌려받는다.
+    if (table.state == GS_INSURANCE) {
+        const double p = GetRankProbability(&counts, RANK_COUNT - 1);
+
+        insuranceEv = p - 0.5 * (1.0 - p);
+
+        return;
+    }
+
+    const Hand *activeHand = &table.playerHands[table.activeSeat][table.activeHand];
+
+    SolveHand(
+        &solver,
+        &table.rules,
+        activeHand,
+        GetCardRank(table.dealerHand.cards[0]),
+        &counts,
+        &hint
+    );
+
+    // 지금 선택할 수 없는 행동은 추천하지 않는다.
+    hint.available &= GetTableActions(&table);
+    hint.best = PA_STAND;
 
-    gameState = GS_INIT;
+    for (int i = 0; i < _PA_COUNT; i++)
+        if ((hint.available & (1 << i)) && hint.ev[i] > hint.ev[hint.best])
+            hint.best = i;
 
-    GenerateDeck();
+    bustProbability = GetBustProbability(&counts, activeHand);
 }
\ No newline at end of file
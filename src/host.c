@@ -0,0 +1,300 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "b021-engine.h"
+
+/* | `host` 모듈 매크로 정의... | */
+
+#define HOST_INDEX_MASK  ((UINT64_C(1) << HOST_INDEX_BITS) - 1)
+#define HOST_NO_BLOCK    -1
+
+/* 블랙잭 테이블의 번호에서 블록의 번호를 꺼낸다. */
+#define GET_TABLE_INDEX(id)       ((int32_t) ((id) & HOST_INDEX_MASK))
+
+/* 블록의 번호와 세대 번호로 블랙잭 테이블의 번호를 만든다. */
+#define MAKE_TABLE_ID(index, generation) \
+    ((TableId) (((uint64_t) (generation) << HOST_INDEX_BITS) | (uint32_t) (index)))
+
+/* | `host` 모듈 함수... | */
+
+/* 블록의 번호에 해당하는 블랙잭 테이블 블록을 반환한다. */
+static HostedTable *GetHostedTable(const TableHost *host, int32_t index);
+
+/* 블랙잭 테이블의 번호가 가리키는 사용 중인 블록을 반환한다. */
+static HostedTable *FindHostedTable(const TableHost *host, TableId id);
+
+/* 슬랩을 하나 더 할당하고, 새 블록들을 빈 블록 목록에 추가한다. */
+static bool AddHostSlab(TableHost *host);
+
+/* 블록을 처리할 테이블 목록의 맨 뒤에 추가한다. */
+static void PushReadyTable(TableHost *host, int32_t index);
+
+/* 블랙잭 테이블에서 봇 플레이어가 행동할 차례인지 확인한다. */
+static bool IsBotTurn(const HostedTable *block);
+
+/* 테이블 호스트를 초기화한다. */
+void InitTableHost(
+    TableHost *host,
+    uint64_t seed,
+    HostRoundCallback onRoundEnd,
+    void *userData
+) {
+    if (host == NULL) return;
+
+    *host = (TableHost) {
+        .freeHead = HOST_NO_BLOCK,
+        .readyHead = HOST_NO_BLOCK,
+        .readyTail = HOST_NO_BLOCK,
+        .onRoundEnd = onRoundEnd,
+        .userData = userData
+    };
+
+    InitRandomState(&host->random, seed);
+}
+
+/* 테이블 호스트에 할당된 메모리를 해제한다. */
+void FreeTableHost(TableHost *host) {
+    if (host == NULL) return;
+
+    for (int i = 0; i < host->slabCount; i++)
+        free(host->slabs[i]);
+
+    free(host->slabs);
+
+    host->slabs = NULL;
+    host->slabCount = host->slabCapacity = host->tableCount = 0;
+
+    host->freeHead = host->readyHead = host->readyTail = HOST_NO_BLOCK;
+}
+
+/* 테이블 호스트에 블랙잭 테이블을 하나 열고, 테이블의 번호를 반환한다. */
+TableId OpenHostTable(TableHost *host, const Rules *rules, const BotPolicy *const *bots) {
+    if (host == NULL) return HOST_INVALID_TABLE;
+
+    if (host->freeHead == HOST_NO_BLOCK && !AddHostSlab(host)) return HOST_INVALID_TABLE;
+
+    const int32_t index = host->freeHead;
+
+    HostedTable *block = GetHostedTable(host, index);
+
+    host->freeHead = block->nextFree;
+
+    // 테이블마다 다른 시드 값을 사용하므로, 난수열을 건너뛸 필요가 없다.
+    InitTable(&block->table, rules, GetNextRandom(&host->random), 0);
+
+    for (int i = 0; i < MAX_SEAT_COUNT; i++)
+        block->bots[i] = (bots != NULL) ? bots[i] : NULL;
+
+    block->eventHead = block->eventCount = 0;
+    block->used = true;
+
+    host->tableCount++;
+
+    return MAKE_TABLE_ID(index, block->generation);
+}
+
+/* 테이블 호스트의 블랙잭 테이블을 닫는다. */
+void CloseHostTable(TableHost *host, TableId id) {
+    HostedTable *block = FindHostedTable(host, id);
+
+    if (block == NULL) return;
+
+    // 처리할 테이블 목록에 남은 블록은 목록에서 꺼낼 때 건너뛴다.
+    block->used = false;
+
+    // 세대 번호가 한 바퀴 돌면 예전 번호가 다시 유효해지므로, 블록을 더 이상 사용하지 않는다.
+    if (++block->generation == 0) {
+        host->tableCount--;
+
+        return;
+    }
+
+    block->nextFree = host->freeHead;
+    host->freeHead = GET_TABLE_INDEX(id);
+
+    host->tableCount--;
+}
+
+/* 테이블 호스트의 블랙잭 테이블을 반환한다. */
+const Table *GetHostTable(const TableHost *host, TableId id) {
+    const HostedTable *block = FindHostedTable(host, id);
+
+    return (block != NULL) ? &block->table : NULL;
+}
+
+/* 테이블 호스트의 블랙잭 테이블에 이벤트를 하나 보낸다. */
+bool PostHostEvent(TableHost *host, TableId id, uint8_t event) {
+    HostedTable *block = FindHostedTable(host, id);
+
+    if (block == NULL || block->eventCount >= HOST_EVENT_QUEUE_SIZE) return false;
+
+    block->events[(block->eventHead + block->eventCount++) % HOST_EVENT_QUEUE_SIZE] = event;
+
+    if (!block->ready) PushReadyTable(host, GET_TABLE_INDEX(id));
+
+    return true;
+}
+
+/*
+    처리할 이벤트가 있거나 봇 플레이어의 차례인 블랙잭 테이블들을
+    돌아가며 최대 `maxEvents`개의 이벤트를 처리하고, 처리한 이벤트의 수를
+    반환한다.
+
+    한 테이블의 이벤트는 한 번에 하나씩만 처리하고 목록의 맨 뒤로 보내므로,
+    이벤트가 많은 테이블이 다른 테이블의 차례를 막지 않는다.
+*/
+int RunTableHost(TableHost *host, int maxEvents) {
+    if (host == NULL) return 0;
+
+    int eventCount = 0;
+
+    while (eventCount < maxEvents && host->readyHead != HOST_NO_BLOCK) {
+        const int32_t index = host->readyHead;
+
+        HostedTable *block = GetHostedTable(host, index);
+
+        host->readyHead = block->nextReady;
+
+        if (host->readyHead == HOST_NO_BLOCK) host->readyTail = HOST_NO_BLOCK;
+
+        block->ready = false;
+
+        if (!block->used) continue;
+
+        Table *table = &block->table;
+
+        uint8_t event;
+
+        // 봇 플레이어의 차례라면, 큐에 쌓인 이벤트보다 봇 플레이어의 행동이 먼저이다.
+        if (IsBotTurn(block)) {
+            event = GetSeatBotAction(table, (void *) block->bots);
+        } else if (block->eventCount > 0) {
+            event = block->events[block->eventHead];
+
+            block->eventHead = (block->eventHead + 1) % HOST_EVENT_QUEUE_SIZE;
+            block->eventCount--;
+        } else {
+            continue;
+        }
+
+        const GameState previousState = table->state;
+
+        if (event == RE_RESET) ResetTable(table);
+        else if (event < _PA_COUNT) TakeTableTurn(table, (PlayerAction) event);
+
+        eventCount++;
+
+        const TableId id = MAKE_TABLE_ID(index, block->generation);
+
+        // 콜백 함수에서 이벤트를 보내거나 테이블을 닫을 수 있다.
+        if (previousState != GS_ROUND_END && table->state == GS_ROUND_END
+            && host->onRoundEnd != NULL)
+            host->onRoundEnd(host, id, table, host->userData);
+
+        if (block->used && !block->ready && (block->eventCount > 0 || IsBotTurn(block)))
+            PushReadyTable(host, index);
+    }
+
+    return eventCount;
+}
+
+/* 블록의 번호에 해당하는 블랙잭 테이블 블록을 반환한다. */
+static HostedTable *GetHostedTable(const TableHost *host, int32_t index) {
+    return &host->slabs[index / HOST_SLAB_TABLE_COUNT][index % HOST_SLAB_TABLE_COUNT];
+}
+
+/* 블랙잭 테이블의 번호가 가리키는 사용 중인 블록을 반환한다. */
+static HostedTable *FindHostedTable(const TableHost *host, TableId id) {
+    if (host == NULL || id == HOST_INVALID_TABLE) return NULL;
+
+    const int32_t index = GET_TABLE_INDEX(id);
+
+    if (index < 0 || index >= host->slabCount * HOST_SLAB_TABLE_COUNT) return NULL;
+
+    HostedTable *block = GetHostedTable(host, index);
+
+    // 이미 닫은 테이블의 번호는 세대 번호가 달라서 다른 테이블을 가리키지 않는다.
+    if (!block->used || MAKE_TABLE_ID(index, block->generation) != id) return NULL;
+
+    return block;
+}
+
+/* 슬랩을 하나 더 할당하고, 새 블록들을 빈 블록 목록에 추가한다. */
+static bool AddHostSlab(TableHost *host) {
+    if ((int64_t) (host->slabCount + 1) * HOST_SLAB_TABLE_COUNT > INT32_MAX)
+        return false;
+
+    // 블록은 슬랩 단위로만 할당하므로, 슬랩 배열이 커져도 블록의 주소는 바뀌지 않는다.
+    if (host->slabCount >= host->slabCapacity) {
+        const int capacity = (host->slabCapacity > 0) ? 2 * host->slabCapacity : 16;
+
+        HostedTable **slabs = realloc(host->slabs, capacity * sizeof(*slabs));
+
+        if (slabs == NULL) return false;
+
+        host->slabs = slabs, host->slabCapacity = capacity;
+    }
+
+    HostedTable *slab = calloc(HOST_SLAB_TABLE_COUNT, sizeof(*slab));
+
+    if (slab == NULL) return false;
+
+    const int32_t first = host->slabCount * HOST_SLAB_TABLE_COUNT;
+
+    host->slabs[host->slabCount++] = slab;
+
+    // 빈 블록 목록은 번호가 작은 블록부터 사용하도록 뒤에서부터 쌓는다.
+    for (int i = HOST_SLAB_TABLE_COUNT - 1; i >= 0; i--) {
+        slab[i].nextFree = host->freeHead;
+        slab[i].nextReady = HOST_NO_BLOCK;
+
+        host->freeHead = first + i;
+    }
+
+    return true;
+}
+
+/* 블록을 처리할 테이블 목록의 맨 뒤에 추가한다. */
+static void PushReadyTable(TableHost *host, int32_t index) {
+    HostedTable *block = GetHostedTable(host, index);
+
+    block->ready = true;
+    block->nextReady = HOST_NO_BLOCK;
+
+    if (host->readyTail != HOST_NO_BLOCK)
+        GetHostedTable(host, host->readyTail)->nextReady = index;
+    else
+        host->readyHead = index;
+
+    host->readyTail = index;
+}
+
+/* 블랙잭 테이블에서 봇 플레이어가 행동할 차례인지 확인한다. */
+static bool IsBotTurn(const HostedTable *block) {
+    return (block->table.state == GS_INSURANCE || block->table.state == GS_PLAYER_TURN)
+        && block->bots[block->table.activeSeat] != NULL;
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "b021.h"
+
+#include "rlgl.h"
+
+/* | `label` 모듈 함수... | */
+
+/* `label`의 문자열을 글리프 사각형들로 배치한다. */
+static void LayoutTextLabel(TextLabel *label);
+
+/* 텍스트 레이블을 초기화한다. */
+void InitTextLabel(TextLabel *label, Font font, float fontSize, float spacing) {
+    if (label == NULL) return;
+
+    *label = (TextLabel) {
+        .dirty = true,
+        .font = font,
+        .fontSize = fontSize,
+        .spacing = spacing
+    };
+}
+
+/* 텍스트 레이블의 문자열을 `text`로 변경한다. */
+void SetTextLabel(TextLabel *label, const char *text) {
+    if (label == NULL || text == NULL) return;
+
+    label->dirty = false;
+
+    // 문자열이 그대로라면, 글리프 사각형들을 다시 배치하지 않는다.
+    if (strncmp(label->text, text, MAX_LABEL_LENGTH - 1) == 0) return;
+
+    strncpy(label->text, text, MAX_LABEL_LENGTH - 1);
+
+    label->text[MAX_LABEL_LENGTH - 1] = '\0';
+
+    LayoutTextLabel(label);
+}
+
+/* 텍스트 레이블을 화면에 그린다. */
+void DrawTextLabel(const TextLabel *label, Vector2 position, Color tint) {
+    if (label == NULL || label->length <= 0) return;
+
+    // `DrawTextCodepoint()`처럼 글자의 위치를 정수 좌표에 맞춘다.
+    position.x = (int) position.x, position.y = (int) position.y;
+
+    rlCheckRenderBatchLimit(4 * label->length);
+
+    rlSetTexture(label->font.texture.id);
+
+    rlBegin(RL_QUADS);
+
+    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+
+    for (int i = 0; i < label->length; i++) {
+        const Rectangle source = label->sources[i];
+
+        const Rectangle dest = {
+            .x = position.x + label->dests[i].x,
+            .y = position.y + label->dests[i].y,
+            .width = label->dests[i].width,
+            .height = label->dests[i].height
+        };
+
+        rlTexCoord2f(source.x, source.y);
+        rlVertex2f(dest.x, dest.y);
+
+        rlTexCoord2f(source.x, source.y + source.height);
+        rlVertex2f(dest.x, dest.y + dest.height);
+
+        rlTexCoord2f(source.x + source.width, source.y + source.height);
+        rlVertex2f(dest.x + dest.width, dest.y + dest.height);
+
+        rlTexCoord2f(source.x + source.width, source.y);
+        rlVertex2f(dest.x + dest.width, dest.y);
+    }
+
+    rlEnd();
+
+    rlSetTexture(0);
+}
+
+/* `label`의 문자열을 글리프 사각형들로 배치한다. */
+static void LayoutTextLabel(TextLabel *label) {
+    const Font font = label->font;
+
+    const float scaleFactor = label->fontSize / font.baseSize;
+
+    const float padding = font.glyphPadding;
+
+    const int size = TextLength(label->text);
+
+    float textOffsetX = 0.0f, textOffsetY = 0.0f;
+
+    label->length = 0;
+
+    // `DrawTextEx()`, `DrawTextCodepoint()`와 같은 방법으로 글자들을 배치한다.
+    for (int i = 0; i < size;) {
+        int codepointByteCount = 0;
+
+        const int codepoint = GetCodepoint(&label->text[i], &codepointByteCount);
+        const int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == 0x3f) codepointByteCount = 1;
+
+        i += codepointByteCount;
+
+        if (codepoint == '\n') {
+            textOffsetY += (int) ((font.baseSize + font.baseSize / 2) * scaleFactor);
+            textOffsetX = 0.0f;
+
+            continue;
+        }
+
+        const Rectangle rec = font.recs[index];
+
+        if (codepoint != ' ' && codepoint != '\t') {
+            label->sources[label->length] = (Rectangle) {
+                .x = (rec.x - padding) / font.texture.width,
+                .y = (rec.y - padding) / font.texture.height,
+                .width = (rec.width + 2.0f * padding) / font.texture.width,
+                .height = (rec.height + 2.0f * padding) / font.texture.height
+            };
+
+            label->dests[label->length] = (Rectangle) {
+                .x = (int) textOffsetX + (font.glyphs[index].offsetX - padding) * scaleFactor,
+                .y = textOffsetY + (font.glyphs[index].offsetY - padding) * scaleFactor,
+                .width = (rec.width + 2.0f * padding) * scaleFactor,
+                .height = (rec.height + 2.0f * padding) * scaleFactor
+            };
+
+            label->length++;
+        }
+
+        textOffsetX += (font.glyphs[index].advanceX == 0)
+            ? rec.width * scaleFactor + label->spacing
+            : font.glyphs[index].advanceX * scaleFactor + label->spacing;
+    }
+
+    label->size = MeasureTextEx(font, label->text, label->fontSize, label->spacing);
+}
\ No newline at end of file
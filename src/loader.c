@@ -47,6 +47,9 @@ static Rectangle progressBarOuterBounds = {
     .height = 48.0f
 };
 
+/* 불러오고 있는 리소스 파일의 경로를 보여주는 텍스트 레이블. */
+static TextLabel pathLabel;
+
 /* 로딩 화면에 사용되는 내장 리소스 파일. */
 static Texture2D txMessage01, txMessage02;
 
@@ -86,6 +89,8 @@ void InitLoadingScene(void) {
 
     fntPreload = LoadFontFromImage(imgPreload01, MAGENTA, 0x20);
 
+    InitTextLabel(&pathLabel, fntPreload, PRELOAD_FONT_SIZE, 2.0f);
+
     txMessage01 = LoadTextureFromImage(imgPreload02);
     txMessage02 = LoadTextureFromImage(imgPreload03);
 
@@ -138,6 +143,19 @@ void UpdateLoadingScene(void) {
     if (assetCount < maxAssetCount) {
         Asset *ast = GetAsset(assetCount);
 
+        // 불러올 리소스 파일이 바뀔 때만 문자열을 다시 만든다.
+        if (pathLabel.dirty) {
+            SetTextLabel(
+                &pathLabel, 
+                TextFormat(
+                    "./%s (%d / %d)", 
+                    ast->path,
+                    assetCount + 1,
+                    maxAssetCount
+                )
+            );
+        }
+
         if (frameTimer >= 0.5f * LOADER_DELAY_TIME) {
             bool check = LoadAsset(assetCount);
 
@@ -148,31 +166,16 @@ void UpdateLoadingScene(void) {
             }
 
             assetCount++, frameTimer = 0.0f;
-        }
 
-        const char *pathText = TextFormat(
-            "./%s (%d / %d)", 
-            ast->path,
-            assetCount + 1,
-            maxAssetCount
-        );
-
-        const Vector2 textDimensions = MeasureTextEx(
-            fntPreload,
-            pathText,
-            PRELOAD_FONT_SIZE,
-            2.0f
-        );
+            pathLabel.dirty = true;
+        }
 
-        DrawTextEx(
-            fntPreload,
-            pathText,
+        DrawTextLabel(
+            &pathLabel,
             (Vector2) {
-                0.5f * (SCREEN_WIDTH - textDimensions.x),
+                0.5f * (SCREEN_WIDTH - pathLabel.size.x),
                 progressBarOuterBounds.y + 63.0f
             },
-            PRELOAD_FONT_SIZE,
-            2.0f,
             WHITE
         );
     } else {
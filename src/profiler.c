@@ -0,0 +1,227 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+
+#include "b021.h"
+
+/* | `profiler` 모듈 매크로 정의... | */
+
+#define PROFILER_FONT_SIZE     10
+#define PROFILER_LINE_HEIGHT   12.0f
+
+#define PROFILER_COLUMN_WIDTH  56.0f
+#define PROFILER_GRAPH_HEIGHT  48.0f
+
+#define PROFILER_BACKGROUND_COLOR  ((Color) { 0, 0, 0, 192 })
+
+/* | `profiler` 모듈 상수... | */
+
+/* 프레임 구간의 이름. */
+static const char *phaseNames[_PP_COUNT] = {
+    [PP_MOUSE] = "MOUSE",
+    [PP_BOARD] = "BOARD",
+    [PP_DECK] = "DECK",
+    [PP_HANDS] = "HANDS",
+    [PP_FLUSH] = "FLUSH",
+    [PP_SWAP] = "SWAP"
+};
+
+/* | `profiler` 모듈 변수... | */
+
+/* 최근 프레임들의 구간별 시간. (단위: 밀리초, `_PP_COUNT`번째 값은 프레임 시간이다.) */
+static float samples[_PP_COUNT + 1][PROFILER_FRAME_COUNT];
+
+/* 지금 측정 중인 프레임의 구간별 시간. */
+static float currentSample[_PP_COUNT];
+
+/* 구간별 측정을 시작한 시간. */
+static double phaseTimes[_PP_COUNT];
+
+/* 지금 측정 중인 프레임을 시작한 시간. */
+static double frameTime;
+
+/* 다음으로 기록할 프레임의 링 버퍼 인덱스. */
+static int sampleIndex;
+
+/* 지금까지 기록된 프레임의 수. (최대 `PROFILER_FRAME_COUNT`개) */
+static int sampleCount;
+
+/* | `profiler` 모듈 함수... | */
+
+/* `qsort()`를 위해 두 시간 값을 비교한다. */
+static int CompareSamples(const void *a, const void *b);
+
+/* 프로파일러 표의 한 줄을 그린다. */
+static void DrawProfilerRow(const char *columns[4], Vector2 position, Color color);
+
+/* 링 버퍼에 기록된 `samples[i]`의 중앙값, 99번째 백분위수와 최댓값을 구한다. */
+static void GetSampleStats(int i, float *p50, float *p99, float *max);
+
+/* 프레임 하나의 시간 측정을 시작한다. */
+void BeginProfileFrame(void) {
+    for (int i = 0; i < _PP_COUNT; i++)
+        currentSample[i] = 0.0f;
+
+    frameTime = GetTime();
+}
+
+/* 프레임 하나의 시간 측정을 마치고, 측정 결과를 기록한다. */
+void EndProfileFrame(void) {
+    for (int i = 0; i < _PP_COUNT; i++)
+        samples[i][sampleIndex] = currentSample[i];
+
+    samples[_PP_COUNT][sampleIndex] = 1000.0f * (GetTime() - frameTime);
+
+    sampleIndex = (sampleIndex + 1) % PROFILER_FRAME_COUNT;
+
+    if (sampleCount < PROFILER_FRAME_COUNT) sampleCount++;
+}
+
+/* 프레임 구간 `phase`의 시간 측정을 시작한다. */
+void BeginProfilePhase(ProfilePhase phase) {
+    phaseTimes[phase] = GetTime();
+}
+
+/* 프레임 구간 `phase`의 시간 측정을 마친다. */
+void EndProfilePhase(ProfilePhase phase) {
+    // 한 프레임에서 같은 구간을 여러 번 재면, 그 시간을 모두 더한다.
+    currentSample[phase] += 1000.0f * (GetTime() - phaseTimes[phase]);
+}
+
+/* 최근 프레임들의 구간별 시간과 프레임 시간 그래프를 그린다. */
+void DrawProfiler(Vector2 position) {
+    const float frameBudget = 1000.0f / TARGET_FPS;
+
+    const Rectangle bounds = {
+        .x = position.x,
+        .y = position.y,
+        .width = PROFILER_FRAME_COUNT + 8.0f,
+        .height = (_PP_COUNT + 2) * PROFILER_LINE_HEIGHT + PROFILER_GRAPH_HEIGHT + 12.0f
+    };
+
+    DrawRectangleRec(bounds, PROFILER_BACKGROUND_COLOR);
+
+    position.x += 4.0f, position.y += 4.0f;
+
+    DrawProfilerRow(
+        (const char *[4]) { "PHASE (ms)", "P50", "P99", "MAX" },
+        position,
+        LIGHTGRAY
+    );
+
+    for (int i = 0; i <= _PP_COUNT; i++) {
+        float p50, p99, max;
+
+        GetSampleStats(i, &p50, &p99, &max);
+
+        position.y += PROFILER_LINE_HEIGHT;
+
+        // `TextFormat()`은 내부 버퍼를 돌려 쓰므로, 한 줄에 필요한 문자열은 모두 유효하다.
+        DrawProfilerRow(
+            (const char *[4]) {
+                (i < _PP_COUNT) ? phaseNames[i] : "FRAME",
+                TextFormat("%.2f", p50),
+                TextFormat("%.2f", p99),
+                TextFormat("%.2f", max)
+            },
+            position,
+            (i < _PP_COUNT) ? WHITE : YELLOW
+        );
+    }
+
+    position.y += PROFILER_LINE_HEIGHT + 4.0f;
+
+    // 프레임 시간 그래프의 높이는 목표 프레임 시간의 두 배를 기준으로 한다.
+    const float graphScale = PROFILER_GRAPH_HEIGHT / (2.0f * frameBudget);
+
+    const float graphBottom = position.y + PROFILER_GRAPH_HEIGHT;
+
+    // 가장 오래된 프레임부터 왼쪽에서 오른쪽으로 그린다.
+    for (int i = 0; i < sampleCount; i++) {
+        const int j = (sampleIndex - sampleCount + i + PROFILER_FRAME_COUNT)
+            % PROFILER_FRAME_COUNT;
+
+        const float value = samples[_PP_COUNT][j];
+
+        float height = value * graphScale;
+
+        if (height > PROFILER_GRAPH_HEIGHT) height = PROFILER_GRAPH_HEIGHT;
+
+        DrawRectangleRec(
+            (Rectangle) {
+                .x = position.x + i,
+                .y = graphBottom - height,
+                .width = 1.0f,
+                .height = height
+            },
+            (value > frameBudget) ? RED : GREEN
+        );
+    }
+
+    // 목표 프레임 시간을 나타내는 선을 그린다.
+    DrawLineV(
+        (Vector2) { position.x, graphBottom - frameBudget * graphScale },
+        (Vector2) {
+            position.x + PROFILER_FRAME_COUNT,
+            graphBottom - frameBudget * graphScale
+        },
+        YELLOW
+    );
+}
+
+/* `qsort()`를 위해 두 시간 값을 비교한다. */
+static int CompareSamples(const void *a, const void *b) {
+    const float x = *(const float *) a, y = *(const float *) b;
+
+    return (x > y) - (x < y);
+}
+
+/* 프로파일러 표의 한 줄을 그린다. */
+static void DrawProfilerRow(const char *columns[4], Vector2 position, Color color) {
+    for (int i = 0; i < 4; i++)
+        DrawText(
+            columns[i],
+            position.x + (i > 0) * PROFILER_COLUMN_WIDTH * (i + 0.5f),
+            position.y,
+            PROFILER_FONT_SIZE,
+            color
+        );
+}
+
+/* 링 버퍼에 기록된 `samples[i]`의 중앙값, 99번째 백분위수와 최댓값을 구한다. */
+static void GetSampleStats(int i, float *p50, float *p99, float *max) {
+    *p50 = *p99 = *max = 0.0f;
+
+    if (sampleCount <= 0) return;
+
+    float sorted[PROFILER_FRAME_COUNT];
+
+    for (int j = 0; j < sampleCount; j++)
+        sorted[j] = samples[i][j];
+
+    qsort(sorted, sampleCount, sizeof(*sorted), CompareSamples);
+
+    *p50 = sorted[(sampleCount - 1) * 50 / 100];
+    *p99 = sorted[(sampleCount - 1) * 99 / 100];
+    *max = sorted[sampleCount - 1];
+}
\ No newline at end of file
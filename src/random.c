@@ -0,0 +1,115 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "b021-engine.h"
+
+/* | `random` 모듈 함수... | */
+
+/* 64비트 정수를 왼쪽으로 `k`비트만큼 회전시킨다. */
+static inline uint64_t RotateLeft(uint64_t x, int k);
+
+/* 주어진 시드 값으로 난수 생성기를 초기화한다. */
+void InitRandomState(RandomState *rs, uint64_t seed) {
+    if (rs == NULL) return;
+
+    /* https://prng.di.unimi.it/splitmix64.c */
+
+    for (int i = 0; i < 4; i++) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+        rs->s[i] = z ^ (z >> 31);
+    }
+}
+
+/* 난수 생성기의 상태를 2^128번 앞으로 이동시킨다. */
+void JumpRandomState(RandomState *rs) {
+    if (rs == NULL) return;
+
+    static const uint64_t jump[] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+        0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+
+    uint64_t s[4] = { 0 };
+
+    for (int i = 0; i < 4; i++)
+        for (int b = 0; b < 64; b++) {
+            if (jump[i] & (1ULL << b))
+                for (int j = 0; j < 4; j++)
+                    s[j] ^= rs->s[j];
+
+            GetNextRandom(rs);
+        }
+
+    for (int j = 0; j < 4; j++)
+        rs->s[j] = s[j];
+}
+
+/* 64비트 난수를 생성한다. */
+uint64_t GetNextRandom(RandomState *rs) {
+    /* https://prng.di.unimi.it/xoshiro256starstar.c */
+
+    uint64_t *s = rs->s;
+
+    const uint64_t result = RotateLeft(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0], s[3] ^= s[1];
+    s[1] ^= s[2], s[0] ^= s[3];
+
+    s[2] ^= t;
+
+    s[3] = RotateLeft(s[3], 45);
+
+    return result;
+}
+
+/* `[0, bound)` 범위의 편향되지 않은 난수를 생성한다. */
+uint32_t GetBoundedRandom(RandomState *rs, uint32_t bound) {
+    /* https://arxiv.org/abs/1805.10941 */
+
+    uint64_t m = (uint64_t) (uint32_t) (GetNextRandom(rs) >> 32) * bound;
+    uint32_t l = (uint32_t) m;
+
+    // 나눗셈은 확률이 `bound / 2^32` 이하인 경우에만 수행된다.
+    if (l < bound) {
+        const uint32_t threshold = -bound % bound;
+
+        while (l < threshold) {
+            m = (uint64_t) (uint32_t) (GetNextRandom(rs) >> 32) * bound;
+            l = (uint32_t) m;
+        }
+    }
+
+    return m >> 32;
+}
+
+/* 64비트 정수를 왼쪽으로 `k`비트만큼 회전시킨다. */
+static inline uint64_t RotateLeft(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
\ No newline at end of file
@@ -0,0 +1,251 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "b021-engine.h"
+
+/* | `replay` 모듈 매크로 정의... | */
+
+#define RULE_DOUBLE_AFTER_SPLIT  0x01
+#define RULE_SURRENDER           0x02
+#define RULE_HITS_SOFT_17        0x04
+#define RULE_BLACKJACK_6_TO_5    0x08
+#define RULE_CONTINUOUS_SHUFFLE  0x10
+
+#define RULE_ALL_FLAGS           0x1F
+
+/* | `replay` 모듈 상수... | */
+
+/* 리플레이 기록 파일의 시그니처. */
+static const uint8_t replayMagic[4] = { 'B', '0', '2', '1' };
+
+/* | `replay` 모듈 함수... | */
+
+/* 바이트 배열에 리틀 엔디언 정수를 기록한다. */
+static void PutUint(uint8_t *data, uint64_t value, int size);
+
+/* 바이트 배열에서 리틀 엔디언 정수를 읽는다. */
+static uint64_t GetUint(const uint8_t *data, int size);
+
+/* 블랙잭 테이블의 손익을 리플레이 기록의 정수 단위로 변환한다. */
+static int16_t GetScaledPayout(const Table *table);
+
+/* 리플레이 기록 파일을 만들고, 블랙잭 테이블의 시드 값과 규칙을 기록한다. */
+bool OpenReplayWriter(
+    ReplayWriter *writer,
+    const char *path,
+    const Table *table,
+    uint64_t seed,
+    int stream
+) {
+    if (writer == NULL || path == NULL || table == NULL
+        || stream < 0 || stream >= MAX_REPLAY_STREAM) return false;
+
+    writer->file = fopen(path, "wb");
+
+    if (writer->file == NULL) return false;
+
+    uint8_t header[REPLAY_HEADER_SIZE] = { 0 };
+
+    uint32_t penetration;
+
+    memcpy(&penetration, &table->rules.penetration, sizeof(penetration));
+
+    memcpy(header, replayMagic, sizeof(replayMagic));
+
+    header[4] = REPLAY_VERSION;
+    header[5] = table->rules.deckCount;
+    header[6] = table->rules.splitHandCount;
+    header[7] = (table->rules.doubleAfterSplit ? RULE_DOUBLE_AFTER_SPLIT : 0)
+        | (table->rules.surrender ? RULE_SURRENDER : 0)
+        | (table->rules.dealerHitsSoft17 ? RULE_HITS_SOFT_17 : 0)
+        | ((table->rules.blackjackPayout == BP_6_TO_5) ? RULE_BLACKJACK_6_TO_5 : 0)
+        | (table->rules.continuousShuffle ? RULE_CONTINUOUS_SHUFFLE : 0);
+
+    PutUint(header + 8, seed, 8);
+    PutUint(header + 16, (uint32_t) stream, 4);
+    PutUint(header + 20, penetration, 4);
+
+    // 나머지 바이트는 이후 규칙을 위해 비워둔다.
+    header[24] = table->rules.seatCount;
+
+    if (fwrite(header, sizeof(header), 1, writer->file) != 1) {
+        CloseReplayWriter(writer);
+
+        return false;
+    }
+
+    return true;
+}
+
+/* 리플레이 기록 파일을 닫는다. */
+void CloseReplayWriter(ReplayWriter *writer) {
+    if (writer == NULL || writer->file == NULL) return;
+
+    fclose(writer->file);
+
+    writer->file = NULL;
+}
+
+/* 리플레이 기록에 플레이어의 행동이나 블랙잭 테이블 초기화를 기록한다. */
+void WriteReplayEvent(ReplayWriter *writer, uint8_t event) {
+    if (writer == NULL || writer->file == NULL) return;
+
+    putc(event, writer->file);
+}
+
+/* 리플레이 기록에 블랙잭 테이블의 게임 결과를 기록한다. */
+void WriteReplayOutcome(ReplayWriter *writer, const Table *table) {
+    if (writer == NULL || writer->file == NULL || table == NULL) return;
+
+    uint8_t record[3] = { RE_OUTCOME };
+
+    PutUint(record + 1, (uint16_t) GetScaledPayout(table), 2);
+
+    fwrite(record, sizeof(record), 1, writer->file);
+
+    // 프로그램이 비정상적으로 종료되어도, 끝난 게임까지는 기록이 남도록 한다.
+    fflush(writer->file);
+}
+
+/*
+    메모리에 불러온 리플레이 기록을 화면에 그리지 않고 다시 실행하여,
+    기록된 결과와 비교한다.
+*/
+bool RunReplay(
+    const uint8_t *data,
+    size_t length,
+    const Rules *rules,
+    ReplayStats *stats
+) {
+    if (data == NULL || stats == NULL || length < REPLAY_HEADER_SIZE) return false;
+
+    if (memcmp(data, replayMagic, sizeof(replayMagic)) != 0
+        || data[4] != REPLAY_VERSION) return false;
+
+    Rules recordedRules = {
+        .deckCount = data[5],
+        .seatCount = data[24],
+        .splitHandCount = data[6],
+        .doubleAfterSplit = data[7] & RULE_DOUBLE_AFTER_SPLIT,
+        .surrender = data[7] & RULE_SURRENDER,
+        .dealerHitsSoft17 = data[7] & RULE_HITS_SOFT_17,
+        .blackjackPayout = (data[7] & RULE_BLACKJACK_6_TO_5) ? BP_6_TO_5 : BP_3_TO_2,
+        .continuousShuffle = data[7] & RULE_CONTINUOUS_SHUFFLE
+    };
+
+    const uint32_t penetration = GetUint(data + 20, 4);
+
+    memcpy(&recordedRules.penetration, &penetration, sizeof(penetration));
+
+    const uint32_t stream = GetUint(data + 16, 4);
+
+    /*
+        헤더는 신뢰할 수 없는 파일에서 읽으므로, 기록기가 쓸 수 있는 범위를
+        벗어난 값은 `InitTable()`에 넘기지 않는다. (`NaN`도 여기서 걸러진다.)
+    */
+    if (recordedRules.deckCount < 1 || recordedRules.deckCount > MAX_DECK_COUNT
+        || recordedRules.seatCount < 1 || recordedRules.seatCount > MAX_SEAT_COUNT
+        || recordedRules.splitHandCount < 1
+        || recordedRules.splitHandCount > MAX_SPLIT_HAND_COUNT
+        || !(recordedRules.penetration >= MIN_PENETRATION
+            && recordedRules.penetration <= MAX_PENETRATION)
+        || (data[7] & ~RULE_ALL_FLAGS) != 0
+        || stream >= MAX_REPLAY_STREAM) return false;
+
+    Table table;
+
+    InitTable(
+        &table,
+        (rules != NULL) ? rules : &recordedRules,
+        GetUint(data + 8, 8),
+        (int) stream
+    );
+
+    *stats = (ReplayStats) { .firstMismatch = -1 };
+
+    for (size_t i = REPLAY_HEADER_SIZE; i < length; i++) {
+        const size_t offset = i;
+
+        const uint8_t event = data[i];
+
+        bool matched = true;
+
+        if (event == RE_RESET) {
+            ResetTable(&table);
+        } else if (event == RE_OUTCOME) {
+            if (i + 2 >= length) return false;
+
+            const int16_t payout = (int16_t) GetUint(data + i + 1, 2);
+
+            matched = (table.state == GS_ROUND_END)
+                && (payout == GetScaledPayout(&table));
+
+            stats->roundCount++;
+
+            stats->payout += (double) payout / REPLAY_PAYOUT_SCALE;
+            stats->replayedPayout += table.payout;
+
+            i += 2;
+        } else {
+            matched = TakeTableTurn(&table, (PlayerAction) event);
+
+            stats->actionCount++;
+        }
+
+        if (!matched) {
+            if (stats->firstMismatch < 0) stats->firstMismatch = offset;
+
+            stats->mismatchCount++;
+        }
+    }
+
+    return true;
+}
+
+/* 바이트 배열에 리틀 엔디언 정수를 기록한다. */
+static void PutUint(uint8_t *data, uint64_t value, int size) {
+    for (int i = 0; i < size; i++)
+        data[i] = (value >> (8 * i)) & 0xFF;
+}
+
+/* 바이트 배열에서 리틀 엔디언 정수를 읽는다. */
+static uint64_t GetUint(const uint8_t *data, int size) {
+    uint64_t value = 0;
+
+    for (int i = 0; i < size; i++)
+        value |= (uint64_t) data[i] << (8 * i);
+
+    return value;
+}
+
+/* 블랙잭 테이블의 손익을 리플레이 기록의 정수 단위로 변환한다. */
+static int16_t GetScaledPayout(const Table *table) {
+    const double payout = REPLAY_PAYOUT_SCALE * table->payout;
+
+    return (int16_t) ((payout >= 0.0) ? payout + 0.5 : payout - 0.5);
+}
\ No newline at end of file
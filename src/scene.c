@@ -22,13 +22,24 @@
 
 #include "b021.h"
 
+#include "rlgl.h"
+
 /* | `scene` 모듈 변수... | */
 
 /* 게임의 현재 장면. */
 static SceneType sceneType = ST_INIT;
 
+/* 게임 화면을 다시 그려야 하는지 여부. */
+static bool redrawRequested = true;
+
+/* 게임 화면을 마지막으로 그린 시간. */
+static double redrawTime;
+
 /* | `scene` 모듈 함수... | */
 
+/* 마지막으로 처리한 입력 이벤트 중에 화면에 영향을 주는 이벤트가 있는지 확인한다. */
+static bool HasInputEvents(void);
+
 /* 게임 장면을 변경한다. */
 void LoadScene(SceneType st) {
     if (sceneType == st) return;
@@ -53,6 +64,23 @@ void LoadScene(SceneType st) {
 
 /* 게임 화면을 업데이트한다. */
 void UpdateGame(void) {
+    /*
+        게임 플레이 장면에서는 입력 이벤트가 없고, 게임의 상태가 바뀌지 않았다면
+        화면을 다시 그리지 않고 입력 이벤트만 처리한다. (대기 모드)
+    */
+    if (sceneType == ST_GAME && !redrawRequested && !HasInputEvents()) {
+        WaitTime(IDLE_WAIT_TIME);
+
+        PollInputEvents();
+
+        // 창이 다른 창에 가려졌다가 드러나는 경우를 위해, 가끔씩은 화면을 다시 그린다.
+        if (GetTime() - redrawTime < IDLE_REDRAW_TIME) return;
+    }
+
+    redrawRequested = false;
+
+    BeginProfileFrame();
+
     BeginDrawing();
 
     switch (sceneType) {
@@ -77,5 +105,39 @@ void UpdateGame(void) {
             break;
     }
 
+    // `EndDrawing()`이 하는 일을 렌더 배치 비우기와 화면 버퍼 교체로 나누어 잰다.
+    BeginProfilePhase(PP_FLUSH);
+
+    rlDrawRenderBatchActive();
+
+    EndProfilePhase(PP_FLUSH);
+
+    BeginProfilePhase(PP_SWAP);
+
     EndDrawing();
+
+    EndProfilePhase(PP_SWAP);
+
+    EndProfileFrame();
+
+    redrawTime = GetTime();
+}
+
+/* 다음 프레임에 게임 화면을 다시 그리도록 요청한다. */
+void RequestRedraw(void) {
+    redrawRequested = true;
+}
+
+/* 마지막으로 처리한 입력 이벤트 중에 화면에 영향을 주는 이벤트가 있는지 확인한다. */
+static bool HasInputEvents(void) {
+    if (GetKeyPressed() != 0 || GetMouseWheelMove() != 0.0f) return true;
+
+    const Vector2 mouseDelta = GetMouseDelta();
+
+    if (mouseDelta.x != 0.0f || mouseDelta.y != 0.0f) return true;
+
+    for (int i = MOUSE_BUTTON_LEFT; i <= MOUSE_BUTTON_MIDDLE; i++)
+        if (IsMouseButtonPressed(i) || IsMouseButtonReleased(i)) return true;
+
+    return IsWindowResized();
 }
\ No newline at end of file
@@ -0,0 +1,1489 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "b021-engine.h"
+
+/* | `sim` 모듈 매크로 정의... | */
+
+#define SIM_NAME                "b021-sim"
+
+#define DEFAULT_HAND_COUNT      10000000LL
+#define DEFAULT_STAND_TOTAL     DEALER_STAND_TOTAL
+#define DEFAULT_BET_SPREAD      8
+#define DEFAULT_SESSION_LENGTH  10000LL
+
+#define HISTOGRAM_ROW_COUNT     8
+#define HISTOGRAM_BAR_WIDTH     40
+
+#define MAX_THREAD_COUNT        256
+
+#define BATCH_HAND_COUNT        65536
+#define MAX_BATCH_CARD_COUNT    6
+
+#define MAX_PATH_LENGTH         4096
+
+#define MAX_CHART_COUNT         64
+
+#define HOST_EVENT_BATCH        4096
+
+/* | `sim` 모듈 상수... | */
+
+/* 기본 전략표를 계산할 덱의 수. */
+static const int chartDeckCounts[] = { 1, 2, 4, 6, 8 };
+
+/* | `sim` 모듈 변수... | */
+
+/* 게임 결과에 따른 플레이어의 손익. (블랙잭 승리는 규칙에 따라 정한다.) */
+static double payouts[_RR_COUNT] = {
+    [RR_PLAYER_WIN] = 1.0,
+    [RR_DEALER_WIN] = -1.0,
+    [RR_PLAYER_BLACKJACK] = 1.5,
+    [RR_SURRENDER] = -0.5
+};
+
+/* 카드 카운팅 방식의 이름. */
+static const char *countSystemNames[_CT_COUNT] = {
+    [CT_HI_LO] = "hilo",
+    [CT_KO] = "ko",
+    [CT_OMEGA_II] = "omega2"
+};
+
+/* 봇 플레이어 종류의 이름. */
+static const char *botTypeNames[_BT_COUNT] = {
+    [BT_BASIC_STRATEGY] = "basic",
+    [BT_COUNT_DEVIATION] = "deviation",
+    [BT_ALWAYS_HIT] = "hit",
+    [BT_NEVER_BUST] = "nobust"
+};
+
+/* 플레이어 행동의 이름. */
+static const char *actionNames[_PA_COUNT] = {
+    [PA_STAND] = "stand",
+    [PA_HIT] = "hit",
+    [PA_DOUBLE] = "double",
+    [PA_SPLIT] = "split",
+    [PA_SURRENDER] = "surrender",
+    [PA_INSURANCE] = "insurance"
+};
+
+/* | `sim` 모듈 자료형 정의... | */
+
+/* 시뮬레이션 작업 스레드의 상태를 나타내는 구조체. */
+typedef struct Worker {
+    pthread_t thread;      // 작업 스레드.
+    Table table;           // 작업 스레드 전용 블랙잭 테이블.
+    Rules rules;           // 블랙잭 게임의 규칙.
+    uint64_t seed;         // 블랙잭 테이블의 시드 값.
+    int stream;            // 블랙잭 테이블의 난수열 번호.
+    int64_t handCount;     // 진행할 게임의 수.
+    int standTotal;        // 플레이어가 카드를 그만 받는 패의 합.
+    int countSystem;       // 베팅 금액을 정할 때 사용하는 카드 카운팅 방식.
+    int betSpread;         // 최소 베팅 금액에 대한 최대 베팅 금액의 비율.
+    const BotPolicy *bot;  // 모든 좌석에 앉힐 봇 플레이어. (`NULL`이면 `standTotal`을 따른다.)
+    int64_t results[_RR_COUNT];  // 게임 결과별 횟수.
+    double wagered;        // 베팅 금액의 합.
+    double profit;         // 손익의 합.
+    double profitSquared;  // 손익의 제곱의 합.
+    double bankroll;       // 세션을 시작할 때의 자금. (0이면 자금 시뮬레이션을 하지 않는다.)
+    int64_t sessionLength;       // 세션 하나에서 진행할 최대 게임 수.
+    int64_t sessionCount;        // 진행할 세션 수.
+    int64_t ruinCount;           // 자금을 모두 잃은 세션 수.
+    int64_t playedHandCount;     // 실제로 진행한 게임의 수.
+    Histogram finalBankrolls;    // 세션이 끝났을 때의 자금 분포.
+    QuantileSketch drawdowns;    // 세션별 최대 낙폭의 분포.
+    QuantileSketch ruinLengths;  // 자금을 모두 잃기까지 진행한 게임 수의 분포.
+} Worker;
+
+/* 테이블 호스트 부하 테스트의 상태를 나타내는 구조체. */
+typedef struct HostLoad {
+    int64_t startedCount;   // 시작한 게임의 수.
+    int64_t finishedCount;  // 끝난 게임의 수.
+    int64_t targetCount;    // 진행할 게임의 수.
+    double payout;          // 모든 좌석의 손익의 합.
+} HostLoad;
+
+/* | `sim` 모듈 함수... | */
+
+/* 현재 시각을 초 단위로 반환한다. */
+static double GetCurrentTime(void);
+
+/* 새 카드 슈에 대한 딜러 패의 확률 분포를 출력한다. */
+static void PrintDealerDistributions(const Rules *rules);
+
+/* 여러 개의 패를 한 번에 계산하는 연산 방식별로 결과와 성능을 비교한다. */
+static int RunBatchBenchmark(int64_t handCount, uint64_t seed);
+
+/* 리플레이 기록 파일을 다시 실행하고, 기록된 결과와 비교한다. */
+static int RunReplayFile(const char *path);
+
+/* 여러 규칙에 대한 기본 전략표를 계산하고, 바이너리와 CSV 파일로 저장한다. */
+static int WriteChartFiles(const char *prefix, const Rules *rules, long threadCount);
+
+/* 무작위로 행동하는 플레이어의 게임을 리플레이 기록 파일에 저장한다. */
+static int WriteReplayFile(
+    const char *path,
+    const Rules *rules,
+    int64_t handCount,
+    uint64_t seed
+);
+
+/* 모든 좌석에 앉힐 봇 플레이어의 행동표를 만든다. */
+static BotPolicy *CreateBotPolicy(
+    BotType type,
+    const char *chartPath,
+    const Rules *rules,
+    long threadCount
+);
+
+/* 정해진 상황의 블랙잭 테이블에서 봇 플레이어와 게임 진행이 올바른지 검사한다. */
+static int RunSelfChecks(const Rules *rules, const char *chartPath, long threadCount);
+
+/* 첫 번째 좌석이 더 나눌 수 없는 8 페어로 딜러의 10과 맞서는 블랙잭 테이블을 만든다. */
+static void SetCappedPairTable(Table *table, const Rules *rules, int trueCount);
+
+/* 블랙잭 테이블의 카드 슈에서 `cardIndices`의 카드가 순서대로 나오도록 카드를 놓는다. */
+static void StackTableShoe(Table *table, const int *cardIndices, int count);
+
+/* 하나의 테이블 호스트에서 봇 플레이어만 앉은 여러 개의 블랙잭 테이블을 진행한다. */
+static int RunHostBenchmark(
+    int tableCount,
+    const Rules *rules,
+    const BotPolicy *bot,
+    int64_t handCount,
+    uint64_t seed
+);
+
+/* 테이블 호스트의 블랙잭 테이블에서 게임이 끝나면, 다음 게임을 시작한다. */
+static void OnHostRoundEnd(TableHost *host, TableId id, const Table *table, void *userData);
+
+/* 작업 스레드에서 시뮬레이션을 진행한다. */
+static void *RunWorker(void *arg);
+
+/* 작업 스레드의 블랙잭 테이블에서 게임을 한 판 진행하고, 첫 번째 좌석의 손익을 반환한다. */
+static double PlayWorkerRound(Worker *worker, RoundResult *result);
+
+/* 작업 스레드에서 플레이어의 자금이 변하는 세션들을 시뮬레이션한다. */
+static void RunSessions(Worker *worker);
+
+/* 모든 작업 스레드의 세션 결과를 합쳐서 출력한다. */
+static void PrintSessionStats(Worker *workers, long threadCount, double elapsedTime);
+
+/* 히스토그램을 막대 그래프로 출력한다. */
+static void PrintHistogram(const Histogram *histogram);
+
+/* 카드 카운팅 결과에 따른 베팅 금액을 반환한다. */
+static int GetBetUnits(const Table *table, CountSystem system, int betSpread);
+
+/* 프로그램의 사용법을 출력한다. */
+static void PrintUsage(void);
+
+int main(int argc, char *argv[]) {
+    long threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+
+    int64_t handCount = DEFAULT_HAND_COUNT;
+    uint64_t seed = (uint64_t) time(NULL);
+
+    int standTotal = DEFAULT_STAND_TOTAL;
+
+    int countSystem = -1, betSpread = DEFAULT_BET_SPREAD, botType = -1, hostTableCount = 0;
+
+    double bankroll = 0.0;
+
+    int64_t sessionLength = DEFAULT_SESSION_LENGTH;
+
+    Rules rules = GetDefaultRules();
+
+    bool batchMode = false, checkMode = false, dealerMode = false;
+
+    const char *replayPath = NULL, *recordPath = NULL, *chartPrefix = NULL, *chartPath = NULL;
+
+    int option;
+
+    while ((option = getopt(argc, argv, "a:b:c:d:hj:l:n:p:r:s:t:BC:DHL:MP:R:S:T:VW:")) != -1) {
+        switch (option) {
+            case 'a':
+                botType = -1;
+
+                for (int i = 0; i < _BT_COUNT; i++)
+                    if (strcmp(optarg, botTypeNames[i]) == 0)
+                        botType = i;
+
+                if (botType < 0) {
+                    fprintf(stderr, "%s: unknown bot player '%s'\n", SIM_NAME, optarg);
+
+                    return 1;
+                }
+
+                break;
+
+            case 'b':
+                betSpread = (int) strtol(optarg, NULL, 10);
+
+                break;
+
+            case 'c':
+                countSystem = -1;
+
+                for (int i = 0; i < _CT_COUNT; i++)
+                    if (strcmp(optarg, countSystemNames[i]) == 0)
+                        countSystem = i;
+
+                if (countSystem < 0) {
+                    fprintf(stderr, "%s: unknown counting system '%s'\n", SIM_NAME, optarg);
+
+                    return 1;
+                }
+
+                break;
+
+            case 'd':
+                rules.deckCount = (int) strtol(optarg, NULL, 10);
+
+                break;
+
+            case 'B':
+                batchMode = true;
+
+                break;
+
+            case 'C':
+                chartPrefix = optarg;
+
+                break;
+
+            case 'D':
+                dealerMode = true;
+
+                break;
+
+            case 'H':
+                rules.dealerHitsSoft17 = true;
+
+                break;
+
+            case 'L':
+                chartPath = optarg;
+
+                break;
+
+            case 'M':
+                rules.continuousShuffle = true;
+
+                break;
+
+            case 'P':
+                rules.seatCount = (int) strtol(optarg, NULL, 10);
+
+                break;
+
+            case 'j':
+                if (strcmp(optarg, "3:2") == 0) {
+                    rules.blackjackPayout = BP_3_TO_2;
+                } else if (strcmp(optarg, "6:5") == 0) {
+                    rules.blackjackPayout = BP_6_TO_5;
+                } else {
+                    fprintf(stderr, "%s: unknown blackjack payout '%s'\n", SIM_NAME, optarg);
+
+                    return 1;
+                }
+
+                break;
+
+            case 'l':
+                sessionLength = strtoll(optarg, NULL, 10);
+
+                break;
+
+            case 'n':
+                handCount = strtoll(optarg, NULL, 10);
+
+                break;
+
+            case 'p':
+                rules.penetration = strtof(optarg, NULL);
+
+                break;
+
+            case 'r':
+                bankroll = strtod(optarg, NULL);
+
+                break;
+
+            case 's':
+                seed = strtoull(optarg, NULL, 0);
+
+                break;
+
+            case 't':
+                threadCount = strtol(optarg, NULL, 10);
+
+                break;
+
+            case 'R':
+                replayPath = optarg;
+
+                break;
+
+            case 'S':
+                standTotal = (int) strtol(optarg, NULL, 10);
+
+                break;
+
+            case 'T':
+                hostTableCount = (int) strtol(optarg, NULL, 10);
+
+                break;
+
+            case 'V':
+                checkMode = true;
+
+                break;
+
+            case 'W':
+                recordPath = optarg;
+
+                break;
+
+            default:
+                PrintUsage();
+
+                return (option == 'h') ? 0 : 1;
+        }
+    }
+
+    if (threadCount < 1) threadCount = 1;
+    else if (threadCount > MAX_THREAD_COUNT) threadCount = MAX_THREAD_COUNT;
+
+    if (rules.deckCount < 1 || rules.deckCount > MAX_DECK_COUNT) {
+        fprintf(stderr, "%s: deck count must be between 1 and %d\n", SIM_NAME, MAX_DECK_COUNT);
+
+        return 1;
+    }
+
+    if (rules.seatCount < 1 || rules.seatCount > MAX_SEAT_COUNT) {
+        fprintf(stderr, "%s: seat count must be between 1 and %d\n", SIM_NAME, MAX_SEAT_COUNT);
+
+        return 1;
+    }
+
+    // 연속 셔플 기계는 게임 도중에 비지 않도록, 블랙잭 테이블이 덱의 수를 늘릴 수 있다.
+    const int requestedDeckCount = rules.deckCount;
+
+    rules.deckCount = GetTableDeckCount(&rules);
+
+    if (betSpread < 1) betSpread = 1;
+
+    if (sessionLength < 1) sessionLength = 1;
+
+    payouts[RR_PLAYER_BLACKJACK] = GetBlackjackPayout(&rules);
+
+    if (dealerMode) {
+        PrintDealerDistributions(&rules);
+
+        return 0;
+    }
+
+    if (batchMode) return RunBatchBenchmark(handCount, seed);
+
+    if (replayPath != NULL) return RunReplayFile(replayPath);
+
+    if (chartPrefix != NULL) return WriteChartFiles(chartPrefix, &rules, threadCount);
+
+    if (recordPath != NULL) return WriteReplayFile(recordPath, &rules, handCount, seed);
+
+    if (checkMode) return RunSelfChecks(&rules, chartPath, threadCount);
+
+    if (handCount < threadCount) {
+        fprintf(stderr, "%s: hand count must be at least %ld\n", SIM_NAME, threadCount);
+
+        return 1;
+    }
+
+    BotPolicy *bot = NULL;
+
+    // 테이블 호스트의 모든 좌석에는 봇 플레이어가 앉으므로, 기본값으로 전략표가 필요 없는 봇을 쓴다.
+    if (hostTableCount > 0 && botType < 0) botType = BT_NEVER_BUST;
+
+    if (botType >= 0) {
+        bot = CreateBotPolicy(botType, chartPath, &rules, threadCount);
+
+        if (bot == NULL) return 1;
+    }
+
+    if (hostTableCount > 0) {
+        const int status = RunHostBenchmark(hostTableCount, &rules, bot, handCount, seed);
+
+        free(bot);
+
+        return status;
+    }
+
+    Worker *workers = calloc(threadCount, sizeof(*workers));
+
+    if (workers == NULL) {
+        fprintf(stderr, "%s: unable to allocate %ld worker(s)\n", SIM_NAME, threadCount);
+
+        free(bot);
+
+        return 1;
+    }
+
+    // 자금 시뮬레이션에서는 전체 게임 수를 세션 길이로 나눠서 세션 수를 정한다.
+    const int64_t sessionCount = (handCount + sessionLength - 1) / sessionLength;
+
+    if (bankroll > 0.0)
+        printf(
+            "%s: %" PRId64 " session(s) of up to %" PRId64 " hand(s)"
+            " on %ld thread(s), seed 0x%016" PRIx64 "\n",
+            SIM_NAME,
+            sessionCount,
+            sessionLength,
+            threadCount,
+            seed
+        );
+    else
+        printf(
+            "%s: %" PRId64 " hand(s) on %ld thread(s), seed 0x%016" PRIx64 "\n",
+            SIM_NAME,
+            handCount,
+            threadCount,
+            seed
+        );
+
+    char strategy[32];
+
+    if (bot != NULL)
+        snprintf(strategy, sizeof(strategy), "playing the %s bot", botTypeNames[botType]);
+    else
+        snprintf(strategy, sizeof(strategy), "standing on %d", standTotal);
+
+    if (rules.continuousShuffle && rules.deckCount != requestedDeckCount)
+        printf(
+            "  %d deck(s) in a continuous shuffler (raised from %d so it cannot run dry), %s\n",
+            rules.deckCount,
+            requestedDeckCount,
+            strategy
+        );
+    else if (rules.continuousShuffle)
+        printf(
+            "  %d deck(s) in a continuous shuffler, %s\n",
+            rules.deckCount,
+            strategy
+        );
+    else
+        printf(
+            "  %d deck(s), %.0f%% penetration, %s\n",
+            rules.deckCount,
+            100.0f * rules.penetration,
+            strategy
+        );
+
+    printf(
+        "  dealer %s soft 17, blackjack pays %s\n",
+        rules.dealerHitsSoft17 ? "hits" : "stands on",
+        (rules.blackjackPayout == BP_6_TO_5) ? "6:5" : "3:2"
+    );
+
+    // 다른 좌석도 같은 방식으로 행동하지만, 결과는 첫 번째 좌석만 집계한다.
+    if (rules.seatCount > 1)
+        printf("  %d seat(s) at the table, reporting the first base\n", rules.seatCount);
+
+    if (countSystem >= 0)
+        printf(
+            "  betting 1-%d unit(s) on the %s count\n",
+            betSpread,
+            countSystemNames[countSystem]
+        );
+
+    if (bankroll > 0.0)
+        printf("  starting every session with %.0f unit(s)\n", bankroll);
+
+    const double startTime = GetCurrentTime();
+
+    for (long i = 0; i < threadCount; i++) {
+        workers[i].rules = rules;
+        workers[i].seed = seed, workers[i].stream = (int) i;
+        workers[i].standTotal = standTotal;
+        workers[i].countSystem = countSystem;
+        workers[i].betSpread = betSpread;
+        workers[i].bot = bot;
+
+        // 남는 게임은 첫 번째 작업 스레드가 진행한다.
+        workers[i].handCount = handCount / threadCount
+            + ((i == 0) ? handCount % threadCount : 0);
+
+        workers[i].bankroll = bankroll;
+        workers[i].sessionLength = sessionLength;
+        workers[i].sessionCount = sessionCount / threadCount
+            + ((i == 0) ? sessionCount % threadCount : 0);
+
+        InitHistogram(&workers[i].finalBankrolls, 0.0, 2.0 * bankroll);
+
+        InitQuantileSketch(&workers[i].drawdowns);
+        InitQuantileSketch(&workers[i].ruinLengths);
+
+        if (pthread_create(&workers[i].thread, NULL, RunWorker, &workers[i]) != 0) {
+            fprintf(stderr, "%s: unable to create thread #%ld\n", SIM_NAME, i);
+
+            return 1;
+        }
+    }
+
+    int64_t results[_RR_COUNT] = { 0 };
+
+    double wagered = 0.0, profit = 0.0, profitSquared = 0.0;
+
+    for (long i = 0; i < threadCount; i++) {
+        pthread_join(workers[i].thread, NULL);
+
+        for (int j = 0; j < _RR_COUNT; j++)
+            results[j] += workers[i].results[j];
+
+        wagered += workers[i].wagered;
+        profit += workers[i].profit;
+        profitSquared += workers[i].profitSquared;
+    }
+
+    const double elapsedTime = GetCurrentTime() - startTime;
+
+    if (bankroll > 0.0) {
+        PrintSessionStats(workers, threadCount, elapsedTime);
+
+        free(workers), free(bot);
+
+        return 0;
+    }
+
+    double ev = 0.0, variance = 0.0;
+
+    // 봇 플레이어의 더블다운과 스플릿은 게임 결과만으로 손익을 알 수 없다.
+    if (countSystem >= 0 || bot != NULL) {
+        ev = profit, variance = profitSquared;
+    } else {
+        for (int j = 0; j < _RR_COUNT; j++) {
+            ev += payouts[j] * results[j];
+            variance += payouts[j] * payouts[j] * results[j];
+        }
+    }
+
+    ev /= handCount, variance = variance / handCount - ev * ev;
+
+    printf("  win / loss / push : %.4f%% / %.4f%% / %.4f%% (blackjack: %.4f%%)\n",
+        100.0 * (results[RR_PLAYER_WIN] + results[RR_PLAYER_BLACKJACK]) / handCount,
+        100.0 * results[RR_DEALER_WIN] / handCount,
+        100.0 * results[RR_PUSH] / handCount,
+        100.0 * results[RR_PLAYER_BLACKJACK] / handCount
+    );
+
+    printf("  EV per hand       : %+.6f (± %.6f)\n", ev, 1.96 * sqrt(variance / handCount));
+    printf("  variance          : %.6f\n", variance);
+
+    if (countSystem >= 0) {
+        printf("  average bet       : %.4f unit(s)\n", wagered / handCount);
+        printf("  EV per unit bet   : %+.6f\n", profit / wagered);
+    }
+
+    printf("  hands per second  : %.0f (%.3f s)\n", handCount / elapsedTime, elapsedTime);
+
+    free(workers), free(bot);
+
+    return 0;
+}
+
+/* 현재 시각을 초 단위로 반환한다. */
+static double GetCurrentTime(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + 1.0e-9 * ts.tv_nsec;
+}
+
+/* 새 카드 슈에 대한 딜러 패의 확률 분포를 출력한다. */
+static void PrintDealerDistributions(const Rules *rules) {
+    static const char *upcardNames[RANK_COUNT] = {
+        "A", "2", "3", "4", "5", "6", "7", "8", "9", "T"
+    };
+
+    RankCounts counts = { .total = rules->deckCount * MAX_CARD_COUNT };
+
+    for (int i = 0; i < RANK_COUNT; i++)
+        counts.counts[i] = rules->deckCount * ((i == RANK_COUNT - 1) ? 16 : 4);
+
+    printf("%s: dealer final totals for a fresh %d-deck shoe\n", SIM_NAME, rules->deckCount);
+    printf("  up      17      18      19      20      21    bust      BJ\n");
+
+    for (int upcard = 0; upcard < RANK_COUNT; upcard++) {
+        DealerDistribution distribution;
+
+        counts.counts[upcard]--, counts.total--;
+
+        GetDealerDistribution(
+            NULL,
+            &counts,
+            upcard,
+            false,
+            rules->dealerHitsSoft17,
+            &distribution
+        );
+
+        counts.counts[upcard]++, counts.total++;
+
+        printf("  %2s", upcardNames[upcard]);
+
+        for (int j = 0; j < _DO_COUNT; j++)
+            printf("  %.4f", distribution.p[j]);
+
+        printf("\n");
+    }
+}
+
+/* 여러 개의 패를 한 번에 계산하는 연산 방식별로 결과와 성능을 비교한다. */
+static int RunBatchBenchmark(int64_t handCount, uint64_t seed) {
+    static const char *kernelNames[] = {
+        [BK_SCALAR] = "scalar", [BK_SSE2] = "sse2", [BK_AVX2] = "avx2"
+    };
+
+    static uint8_t counts[RANK_COUNT][BATCH_HAND_COUNT];
+
+    static uint8_t expectedTotals[BATCH_HAND_COUNT], expectedFlags[BATCH_HAND_COUNT];
+    static uint8_t totals[BATCH_HAND_COUNT], flags[BATCH_HAND_COUNT];
+
+    RandomState random;
+
+    InitRandomState(&random, seed);
+
+    // 2장부터 `MAX_BATCH_CARD_COUNT`장까지의 카드로 이루어진 패를 무작위로 만든다.
+    for (int i = 0; i < BATCH_HAND_COUNT; i++) {
+        int cardCount = 2 + GetBoundedRandom(&random, MAX_BATCH_CARD_COUNT - 1);
+
+        for (int j = 0; j < cardCount; j++) {
+            int index = GetBoundedRandom(&random, MAX_CARD_NUMBER);
+
+            counts[(index < RANK_COUNT) ? index : RANK_COUNT - 1][i]++;
+        }
+    }
+
+    HandBatch batch = { .length = BATCH_HAND_COUNT };
+
+    for (int r = 0; r < RANK_COUNT; r++)
+        batch.counts[r] = counts[r];
+
+    HandBatchResult expected = { .totals = expectedTotals, .flags = expectedFlags };
+    HandBatchResult result = { .totals = totals, .flags = flags };
+
+    EvaluateHandBatch(&batch, &expected, BK_SCALAR);
+
+    const BatchKernel bestKernel = GetBestBatchKernel();
+
+    const int64_t roundCount = (handCount + BATCH_HAND_COUNT - 1) / BATCH_HAND_COUNT;
+
+    printf(
+        "%s: %" PRId64 " hand(s) per kernel in batches of %d\n",
+        SIM_NAME,
+        roundCount * BATCH_HAND_COUNT,
+        BATCH_HAND_COUNT
+    );
+
+    int mismatchCount = 0;
+
+    for (BatchKernel kernel = BK_SCALAR; kernel <= bestKernel; kernel++) {
+        memset(totals, 0, sizeof(totals)), memset(flags, 0, sizeof(flags));
+
+        const double startTime = GetCurrentTime();
+
+        for (int64_t i = 0; i < roundCount; i++)
+            EvaluateHandBatch(&batch, &result, kernel);
+
+        const double elapsedTime = GetCurrentTime() - startTime;
+
+        int mismatches = 0;
+
+        for (int i = 0; i < BATCH_HAND_COUNT; i++)
+            if (totals[i] != expectedTotals[i] || flags[i] != expectedFlags[i])
+                mismatches++;
+
+        printf(
+            "  %-6s : %.0f hands per second, %d mismatch(es)\n",
+            kernelNames[kernel],
+            (roundCount * BATCH_HAND_COUNT) / elapsedTime,
+            mismatches
+        );
+
+        mismatchCount += mismatches;
+    }
+
+    return (mismatchCount > 0);
+}
+
+/* 리플레이 기록 파일을 다시 실행하고, 기록된 결과와 비교한다. */
+static int RunReplayFile(const char *path) {
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL) {
+        fprintf(stderr, "%s: unable to open '%s'\n", SIM_NAME, path);
+
+        return 1;
+    }
+
+    fseek(file, 0, SEEK_END);
+
+    const long length = ftell(file);
+
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t *data = (length > 0) ? malloc(length) : NULL;
+
+    if (data == NULL || fread(data, 1, length, file) != (size_t) length) {
+        fprintf(stderr, "%s: unable to read '%s'\n", SIM_NAME, path);
+
+        free(data), fclose(file);
+
+        return 1;
+    }
+
+    fclose(file);
+
+    ReplayStats stats;
+
+    const double startTime = GetCurrentTime();
+
+    const bool valid = RunReplay(data, length, NULL, &stats);
+
+    const double elapsedTime = GetCurrentTime() - startTime;
+
+    free(data);
+
+    if (!valid) {
+        fprintf(stderr, "%s: '%s' is not a valid replay log\n", SIM_NAME, path);
+
+        return 1;
+    }
+
+    printf(
+        "%s: replayed %" PRId64 " hand(s), %" PRId64 " action(s) from '%s'\n",
+        SIM_NAME,
+        stats.roundCount,
+        stats.actionCount,
+        path
+    );
+
+    printf(
+        "  payout            : %+.2f recorded, %+.2f replayed\n",
+        stats.payout,
+        stats.replayedPayout
+    );
+
+    if (stats.mismatchCount > 0)
+        printf(
+            "  mismatches        : %" PRId64 " (first at byte %" PRId64 ")\n",
+            stats.mismatchCount,
+            stats.firstMismatch
+        );
+    else
+        printf("  mismatches        : 0\n");
+
+    printf(
+        "  hands per second  : %.0f (%.3f s)\n",
+        stats.roundCount / elapsedTime,
+        elapsedTime
+    );
+
+    return (stats.mismatchCount > 0);
+}
+
+/*
+    여러 규칙에 대한 기본 전략표를 계산하고, 바이너리와 CSV 파일로 저장한다.
+
+    덱의 수, 딜러가 소프트 17에서 카드를 받는지, 카드를 나눈 뒤의 더블 다운
+    가능 여부와 서렌더 가능 여부를 바꾼 규칙마다 전략표를 하나씩 만들고,
+    나머지 규칙은 `rules`를 따른다.
+*/
+static int WriteChartFiles(const char *prefix, const Rules *rules, long threadCount) {
+    const int deckCountCount = sizeof(chartDeckCounts) / sizeof(*chartDeckCounts);
+    const int chartCount = 8 * deckCountCount;
+
+    StrategyChart *charts = calloc(chartCount, sizeof(*charts));
+
+    if (charts == NULL) {
+        fprintf(stderr, "%s: unable to allocate %d chart(s)\n", SIM_NAME, chartCount);
+
+        return 1;
+    }
+
+    for (int i = 0; i < chartCount; i++) {
+        charts[i].rules = *rules;
+
+        const int variant = i / deckCountCount;
+
+        charts[i].rules.deckCount = chartDeckCounts[i % deckCountCount];
+        charts[i].rules.surrender = variant & 1;
+        charts[i].rules.doubleAfterSplit = variant & 2;
+        charts[i].rules.dealerHitsSoft17 = variant & 4;
+    }
+
+    printf(
+        "%s: %d chart(s) of %d cell(s) on %ld thread(s)\n",
+        SIM_NAME,
+        chartCount,
+        CHART_ROW_COUNT * CHART_COLUMN_COUNT,
+        threadCount
+    );
+
+    const double startTime = GetCurrentTime();
+
+    if (!GenerateStrategyCharts(charts, chartCount, (int) threadCount)) {
+        fprintf(stderr, "%s: unable to generate strategy charts\n", SIM_NAME);
+
+        free(charts);
+
+        return 1;
+    }
+
+    const double elapsedTime = GetCurrentTime() - startTime;
+
+    char binaryPath[MAX_PATH_LENGTH], csvPath[MAX_PATH_LENGTH];
+
+    snprintf(binaryPath, sizeof(binaryPath), "%s.bin", prefix);
+    snprintf(csvPath, sizeof(csvPath), "%s.csv", prefix);
+
+    const bool saved = SaveStrategyCharts(binaryPath, charts, chartCount)
+        && ExportStrategyChartsCsv(csvPath, charts, chartCount);
+
+    free(charts);
+
+    if (!saved) {
+        fprintf(stderr, "%s: unable to write '%s' or '%s'\n", SIM_NAME, binaryPath, csvPath);
+
+        return 1;
+    }
+
+    printf(
+        "  cells per second  : %.1f (%.3f s)\n",
+        chartCount * CHART_ROW_COUNT * CHART_COLUMN_COUNT / elapsedTime,
+        elapsedTime
+    );
+
+    printf("  wrote '%s' and '%s'\n", binaryPath, csvPath);
+
+    return 0;
+}
+
+/* 무작위로 행동하는 플레이어의 게임을 리플레이 기록 파일에 저장한다. */
+static int WriteReplayFile(
+    const char *path,
+    const Rules *rules,
+    int64_t handCount,
+    uint64_t seed
+) {
+    static Table table;
+
+    InitTable(&table, rules, seed, 0);
+
+    ReplayWriter writer;
+
+    if (!OpenReplayWriter(&writer, path, &table, seed, 0)) {
+        fprintf(stderr, "%s: unable to create '%s'\n", SIM_NAME, path);
+
+        return 1;
+    }
+
+    // 플레이어의 행동은 블랙잭 테이블과 별도의 난수열로 정한다.
+    RandomState random;
+
+    InitRandomState(&random, ~seed);
+
+    for (int64_t i = 0; i < handCount; i++) {
+        WriteReplayEvent(&writer, RE_RESET);
+
+        ResetTable(&table);
+
+        while (table.state != GS_ROUND_END) {
+            const uint8_t actions = GetTableActions(&table);
+
+            PlayerAction action = PA_STAND;
+
+            if (actions != 0)
+                do {
+                    action = GetBoundedRandom(&random, _PA_COUNT);
+                } while (!(actions & (1 << action)));
+
+            TakeTableTurn(&table, action);
+
+            WriteReplayEvent(&writer, action);
+        }
+
+        WriteReplayOutcome(&writer, &table);
+    }
+
+    CloseReplayWriter(&writer);
+
+    printf("%s: recorded %" PRId64 " hand(s) to '%s'\n", SIM_NAME, handCount, path);
+
+    return 0;
+}
+
+/*
+    하나의 테이블 호스트에서 봇 플레이어만 앉은 여러 개의 블랙잭 테이블을
+    진행한다.
+
+    모든 테이블은 하나의 스레드에서 하나의 이벤트 루프로 진행하며, 게임이
+    끝난 테이블은 진행한 게임의 수가 `handCount`가 될 때까지 다음 게임을
+    바로 시작한다.
+*/
+static int RunHostBenchmark(
+    int tableCount,
+    const Rules *rules,
+    const BotPolicy *bot,
+    int64_t handCount,
+    uint64_t seed
+) {
+    HostLoad load = { .targetCount = handCount };
+
+    TableHost host;
+
+    InitTableHost(&host, seed, OnHostRoundEnd, &load);
+
+    const BotPolicy *bots[MAX_SEAT_COUNT];
+
+    for (int i = 0; i < MAX_SEAT_COUNT; i++)
+        bots[i] = bot;
+
+    const double openTime = GetCurrentTime();
+
+    for (int i = 0; i < tableCount; i++) {
+        const TableId id = OpenHostTable(&host, rules, bots);
+
+        if (id == HOST_INVALID_TABLE) {
+            fprintf(stderr, "%s: unable to open table #%d\n", SIM_NAME, i);
+
+            FreeTableHost(&host);
+
+            return 1;
+        }
+
+        // 처음 `handCount`개의 테이블에만 카드를 나눠준다.
+        if (load.startedCount < load.targetCount && PostHostEvent(&host, id, PA_STAND))
+            load.startedCount++;
+    }
+
+    const double startTime = GetCurrentTime();
+
+    int64_t eventCount = 0;
+
+    for (int count; (count = RunTableHost(&host, HOST_EVENT_BATCH)) > 0; )
+        eventCount += count;
+
+    const double elapsedTime = GetCurrentTime() - startTime;
+
+    printf(
+        "%s: %" PRId64 " hand(s) on %d table(s) in one event loop, seed 0x%016" PRIx64 "\n",
+        SIM_NAME,
+        load.finishedCount,
+        tableCount,
+        seed
+    );
+
+    printf(
+        "  %d seat(s) per table, %.1f MiB in %d slab(s) of %d table(s)\n",
+        rules->seatCount,
+        (double) host.slabCount * HOST_SLAB_TABLE_COUNT * sizeof(HostedTable) / (1 << 20),
+        host.slabCount,
+        HOST_SLAB_TABLE_COUNT
+    );
+
+    printf(
+        "  EV per seat       : %+.6f\n",
+        load.payout / ((double) load.finishedCount * rules->seatCount)
+    );
+
+    printf("  open time         : %.3f s\n", startTime - openTime);
+
+    printf(
+        "  events per second : %.0f (%" PRId64 " event(s))\n",
+        eventCount / elapsedTime,
+        eventCount
+    );
+
+    printf(
+        "  hands per second  : %.0f (%.3f s)\n",
+        load.finishedCount / elapsedTime,
+        elapsedTime
+    );
+
+    FreeTableHost(&host);
+
+    return 0;
+}
+
+/* 테이블 호스트의 블랙잭 테이블에서 게임이 끝나면, 다음 게임을 시작한다. */
+static void OnHostRoundEnd(TableHost *host, TableId id, const Table *table, void *userData) {
+    HostLoad *load = userData;
+
+    load->finishedCount++;
+    load->payout += table->payout;
+
+    if (load->startedCount >= load->targetCount) return;
+
+    // 초기화와 카드 나누기를 한 번에 보내므로, 다음 게임은 다른 테이블의 이벤트 사이에 진행된다.
+    if (PostHostEvent(host, id, RE_RESET) && PostHostEvent(host, id, PA_STAND))
+        load->startedCount++;
+}
+
+/*
+    모든 좌석에 앉힐 봇 플레이어의 행동표를 만든다.
+
+    기본 전략표가 필요한 봇 플레이어는 `chartPath`에서 규칙이 같은 전략표를
+    불러오고, `chartPath`가 없으면 전략표를 직접 계산한다.
+*/
+static BotPolicy *CreateBotPolicy(
+    BotType type,
+    const char *chartPath,
+    const Rules *rules,
+    long threadCount
+) {
+    BotPolicy *bot = malloc(sizeof(*bot));
+
+    StrategyChart *charts = calloc(MAX_CHART_COUNT, sizeof(*charts));
+
+    if (bot == NULL || charts == NULL) {
+        fprintf(stderr, "%s: unable to allocate a bot player\n", SIM_NAME);
+
+        free(bot), free(charts);
+
+        return NULL;
+    }
+
+    const StrategyChart *chart = NULL;
+
+    if (type == BT_BASIC_STRATEGY || type == BT_COUNT_DEVIATION) {
+        if (chartPath != NULL) {
+            const int chartCount = LoadStrategyCharts(chartPath, charts, MAX_CHART_COUNT);
+
+            if (chartCount < 0)
+                fprintf(stderr, "%s: '%s' is not a valid chart file\n", SIM_NAME, chartPath);
+            else if ((chart = FindStrategyChart(charts, chartCount, rules)) == NULL)
+                fprintf(stderr, "%s: no chart in '%s' matches the rules\n", SIM_NAME, chartPath);
+        } else {
+            charts[0].rules = *rules;
+
+            if (GenerateStrategyCharts(charts, 1, (int) threadCount))
+                chart = &charts[0];
+            else
+                fprintf(stderr, "%s: unable to generate a strategy chart\n", SIM_NAME);
+        }
+
+        if (chart == NULL) {
+            free(bot), free(charts);
+
+            return NULL;
+        }
+    }
+
+    InitBotPolicy(bot, type, chart);
+
+    free(charts);
+
+    return bot;
+}
+
+/* 정해진 상황의 블랙잭 테이블에서 봇 플레이어와 게임 진행이 올바른지 검사한다. */
+static int RunSelfChecks(const Rules *rules, const char *chartPath, long threadCount) {
+    BotPolicy *bot = CreateBotPolicy(BT_COUNT_DEVIATION, chartPath, rules, threadCount);
+
+    if (bot == NULL) return 1;
+
+    static Table table;
+
+    int failureCount = 0;
+
+    printf("%s: checking fixed table states\n", SIM_NAME);
+
+    /*
+        더 나눌 수 없는 8 페어는 하드 16으로 행동하므로, 딜러의 10에 대해
+        트루 카운트가 0 이상이면 스탠드하고 그보다 작으면 카드를 받는다.
+    */
+    for (int i = 0; i < 2; i++) {
+        const int trueCount = (i == 0) ? 4 : -2;
+
+        SetCappedPairTable(&table, rules, trueCount);
+
+        // 카드를 나누지 않은 패는 서렌더할 수 있으므로, 서렌더가 먼저이다.
+        const PlayerAction expected = (GetTableActions(&table) & (1 << PA_SURRENDER))
+            ? PA_SURRENDER
+            : (trueCount >= 0) ? PA_STAND : PA_HIT;
+
+        const PlayerAction action = GetBotAction(&table, bot);
+
+        printf(
+            "  capped 8-8 vs 10 at %+d : %s (expected %s)\n",
+            trueCount,
+            actionNames[action],
+            actionNames[expected]
+        );
+
+        if (action != expected) failureCount++;
+    }
+
+    /*
+        딜러의 첫 번째 카드가 에이스이면 블랙잭인 첫 번째 좌석은 건너뛰고,
+        두 번째 좌석에만 인슈어런스를 묻는다.
+    */
+    {
+        static const int cardIndices[] = { 0, 8, 0, 12, 6, 5 };
+
+        Rules naturalRules = *rules;
+
+        naturalRules.seatCount = 2;
+        naturalRules.continuousShuffle = false;
+
+        InitTable(&table, &naturalRules, 0, 0);
+
+        StackTableShoe(&table, cardIndices, sizeof(cardIndices) / sizeof(*cardIndices));
+
+        TakeTableTurn(&table, PA_STAND);
+
+        const int askedSeat = (table.state == GS_INSURANCE) ? table.activeSeat : -1;
+
+        TakeTableTurn(&table, PA_INSURANCE);
+
+        const bool passed = (askedSeat == 1) && !table.insured[0] && table.insured[1]
+            && table.state != GS_INSURANCE;
+
+        printf(
+            "  natural vs dealer ace  : seat %d asked for insurance (expected seat 1)\n",
+            askedSeat
+        );
+
+        if (!passed) failureCount++;
+    }
+
+    free(bot);
+
+    if (failureCount > 0) {
+        fprintf(stderr, "%s: %d check(s) failed\n", SIM_NAME, failureCount);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/* 첫 번째 좌석이 더 나눌 수 없는 8 페어로 딜러의 10과 맞서는 블랙잭 테이블을 만든다. */
+static void SetCappedPairTable(Table *table, const Rules *rules, int trueCount) {
+    InitTable(table, rules, 0, 0);
+
+    const int handCount = table->rules.splitHandCount;
+
+    // 최대 패의 수까지 나눴으므로, 마지막 패는 다시 나눌 수 없다.
+    for (int i = 0; i < handCount; i++) {
+        Hand *hand = &table->playerHands[0][i];
+
+        ClearHand(hand);
+
+        AddHandCard(hand, MAKE_CARD(SU_SPADE, 7));
+        AddHandCard(hand, MAKE_CARD(SU_HEART, 7));
+
+        table->playerHandFlags[0][i] = (handCount > 1) ? PH_SPLIT : 0;
+    }
+
+    ClearHand(&table->dealerHand);
+
+    AddHandCard(&table->dealerHand, MAKE_CARD(SU_SPADE, 9));
+    AddHandCard(&table->dealerHand, MAKE_CARD(SU_CLOVER, 6));
+
+    table->playerHandCounts[0] = handCount;
+    table->activeSeat = 0, table->activeHand = handCount - 1;
+    table->state = GS_PLAYER_TURN;
+
+    // 남은 덱마다 Hi-Lo 러닝 카운트가 1씩 오르거나 내리도록, 2나 10을 공개한다.
+    const int deckCount = table->shoe.length / MAX_CARD_COUNT;
+
+    ResetCardCount(&table->count, table->rules.deckCount);
+
+    for (int i = 0; i < deckCount * abs(trueCount); i++)
+        UpdateCardCount(&table->count, MAKE_CARD(SU_DIAMOND, (trueCount > 0) ? 1 : 9));
+}
+
+/* 블랙잭 테이블의 카드 슈에서 `cardIndices`의 카드가 순서대로 나오도록 카드를 놓는다. */
+static void StackTableShoe(Table *table, const int *cardIndices, int count) {
+    // 카드는 카드 슈의 맨 뒤부터 나온다.
+    for (int i = 0; i < count; i++)
+        table->shoe.cards[table->shoe.length - 1 - i] = MAKE_CARD(SU_SPADE, cardIndices[i]);
+}
+
+/* 작업 스레드에서 시뮬레이션을 진행한다. */
+static void *RunWorker(void *arg) {
+    Worker *worker = arg;
+
+    InitTable(&worker->table, &worker->rules, worker->seed, worker->stream);
+
+    if (worker->bankroll > 0.0) {
+        RunSessions(worker);
+
+        return NULL;
+    }
+
+    // 작업 스레드 간에 공유되는 메모리에 접근하지 않도록 지역 변수를 사용한다.
+    int64_t results[_RR_COUNT] = { 0 };
+
+    if (worker->countSystem < 0 && worker->bot == NULL) {
+        for (int64_t i = 0; i < worker->handCount; i++)
+            results[PlayTableRound(&worker->table, worker->standTotal)]++;
+    } else {
+        double wagered = 0.0, profit = 0.0, profitSquared = 0.0;
+
+        for (int64_t i = 0; i < worker->handCount; i++) {
+            // 베팅 금액은 카드를 받기 전에 공개된 카드만으로 정한다.
+            const int bet = (worker->countSystem >= 0)
+                ? GetBetUnits(&worker->table, worker->countSystem, worker->betSpread)
+                : 1;
+
+            RoundResult result;
+
+            const double payout = bet * PlayWorkerRound(worker, &result);
+
+            results[result]++;
+
+            wagered += bet, profit += payout, profitSquared += payout * payout;
+        }
+
+        worker->wagered = wagered;
+        worker->profit = profit;
+        worker->profitSquared = profitSquared;
+    }
+
+    for (int j = 0; j < _RR_COUNT; j++)
+        worker->results[j] = results[j];
+
+    return NULL;
+}
+
+/* 작업 스레드의 블랙잭 테이블에서 게임을 한 판 진행하고, 첫 번째 좌석의 손익을 반환한다. */
+static double PlayWorkerRound(Worker *worker, RoundResult *result) {
+    Table *table = &worker->table;
+
+    if (worker->bot == NULL) {
+        *result = PlayTableRound(table, worker->standTotal);
+
+        return payouts[*result];
+    }
+
+    PlayTablePolicyRound(table, GetBotAction, (void *) worker->bot);
+
+    *result = table->result;
+
+    return table->payouts[0];
+}
+
+/*
+    작업 스레드에서 플레이어의 자금이 변하는 세션들을 시뮬레이션한다.
+
+    세션은 정해진 게임 수를 모두 진행하거나, 최소 베팅 금액보다 자금이
+    적어지면 끝난다. 세션별 결과는 고정된 크기의 히스토그램과 분위수
+    스케치에만 기록한다.
+*/
+static void RunSessions(Worker *worker) {
+    Table *table = &worker->table;
+
+    int64_t ruinCount = 0, playedHandCount = 0;
+
+    for (int64_t i = 0; i < worker->sessionCount; i++) {
+        double bankroll = worker->bankroll, peak = bankroll, drawdown = 0.0;
+
+        int64_t j = 0;
+
+        for (; j < worker->sessionLength; j++) {
+            int bet = (worker->countSystem >= 0)
+                ? GetBetUnits(table, worker->countSystem, worker->betSpread)
+                : 1;
+
+            // 남은 자금보다 많이 베팅할 수는 없다.
+            if (bet > bankroll) bet = (int) bankroll;
+
+            if (bet < 1) break;
+
+            RoundResult result;
+
+            bankroll += bet * PlayWorkerRound(worker, &result);
+
+            if (bankroll > peak) peak = bankroll;
+            else if (peak - bankroll > drawdown) drawdown = peak - bankroll;
+        }
+
+        playedHandCount += j;
+
+        if (bankroll < 1.0) {
+            AddSketchValue(&worker->ruinLengths, j);
+
+            ruinCount++;
+        }
+
+        AddHistogramValue(&worker->finalBankrolls, bankroll);
+        AddSketchValue(&worker->drawdowns, drawdown);
+    }
+
+    worker->ruinCount = ruinCount;
+    worker->playedHandCount = playedHandCount;
+}
+
+/* 모든 작업 스레드의 세션 결과를 합쳐서 출력한다. */
+static void PrintSessionStats(Worker *workers, long threadCount, double elapsedTime) {
+    // 첫 번째 작업 스레드의 결과에 나머지 작업 스레드의 결과를 합친다.
+    Worker *total = &workers[0];
+
+    for (long i = 1; i < threadCount; i++) {
+        total->sessionCount += workers[i].sessionCount;
+        total->ruinCount += workers[i].ruinCount;
+        total->playedHandCount += workers[i].playedHandCount;
+
+        MergeHistogram(&total->finalBankrolls, &workers[i].finalBankrolls);
+
+        MergeQuantileSketch(&total->drawdowns, &workers[i].drawdowns);
+        MergeQuantileSketch(&total->ruinLengths, &workers[i].ruinLengths);
+    }
+
+    const double ruinRate = (double) total->ruinCount / total->sessionCount;
+
+    printf(
+        "  risk of ruin      : %.4f%% (± %.4f%%)\n",
+        100.0 * ruinRate,
+        100.0 * 1.96 * sqrt(ruinRate * (1.0 - ruinRate) / total->sessionCount)
+    );
+
+    printf(
+        "  session length    : %.1f hand(s) on average\n",
+        (double) total->playedHandCount / total->sessionCount
+    );
+
+    if (total->ruinCount > 0)
+        printf(
+            "  hands to ruin     : p10 %.0f, p50 %.0f, p90 %.0f\n",
+            GetSketchQuantile(&total->ruinLengths, 0.1),
+            GetSketchQuantile(&total->ruinLengths, 0.5),
+            GetSketchQuantile(&total->ruinLengths, 0.9)
+        );
+
+    printf(
+        "  max drawdown      : p50 %.1f, p90 %.1f, p99 %.1f, max %.1f unit(s)\n",
+        GetSketchQuantile(&total->drawdowns, 0.5),
+        GetSketchQuantile(&total->drawdowns, 0.9),
+        GetSketchQuantile(&total->drawdowns, 0.99),
+        total->drawdowns.max
+    );
+
+    printf(
+        "  final bankroll    : p10 %.1f, p50 %.1f, p90 %.1f unit(s)\n",
+        GetHistogramQuantile(&total->finalBankrolls, 0.1),
+        GetHistogramQuantile(&total->finalBankrolls, 0.5),
+        GetHistogramQuantile(&total->finalBankrolls, 0.9)
+    );
+
+    PrintHistogram(&total->finalBankrolls);
+
+    printf(
+        "  hands per second  : %.0f (%.3f s)\n",
+        total->playedHandCount / elapsedTime,
+        elapsedTime
+    );
+}
+
+/* 히스토그램을 막대 그래프로 출력한다. */
+static void PrintHistogram(const Histogram *histogram) {
+    const int binsPerRow = HISTOGRAM_BIN_COUNT / HISTOGRAM_ROW_COUNT;
+
+    const double width = (histogram->max - histogram->min) / HISTOGRAM_ROW_COUNT;
+
+    int64_t rows[HISTOGRAM_ROW_COUNT + 1] = { 0 }, maxRow = 1;
+
+    for (int i = 0; i < HISTOGRAM_BIN_COUNT; i++)
+        rows[i / binsPerRow] += histogram->counts[i];
+
+    // 범위를 벗어난 값은 마지막 줄에 따로 출력한다.
+    rows[0] += histogram->underflow;
+    rows[HISTOGRAM_ROW_COUNT] = histogram->overflow;
+
+    for (int i = 0; i <= HISTOGRAM_ROW_COUNT; i++)
+        if (rows[i] > maxRow) maxRow = rows[i];
+
+    for (int i = 0; i <= HISTOGRAM_ROW_COUNT; i++) {
+        const int length = (int) (HISTOGRAM_BAR_WIDTH * rows[i] / maxRow);
+
+        if (i < HISTOGRAM_ROW_COUNT)
+            printf(
+                "    %8.1f - %-8.1f ",
+                histogram->min + width * i,
+                histogram->min + width * (i + 1)
+            );
+        else
+            printf("    %8.1f +          ", histogram->max);
+
+        printf("%10" PRId64 " %.*s\n", rows[i], length, "########################################");
+    }
+}
+
+/*
+    카드 카운팅 결과에 따른 베팅 금액을 반환한다.
+
+    균형 방식은 트루 카운트를, 불균형 방식인 KO는 러닝 카운트를 사용하며,
+    카운트에서 1을 뺀 만큼 베팅한다.
+*/
+static int GetBetUnits(const Table *table, CountSystem system, int betSpread) {
+    // 다음 게임에서 카드 슈를 다시 섞는다면, 최소 금액만 베팅한다.
+    if (IsTableShoeCut(table)) return 1;
+
+    const double count = (system == CT_KO)
+        ? GetRunningCount(&table->count, system)
+        : GetTrueCount(&table->count, system, table->shoe.length);
+
+    int bet = (int) count - 1;
+
+    if (bet < 1) bet = 1;
+    else if (bet > betSpread) bet = betSpread;
+
+    return bet;
+}
+
+/* 프로그램의 사용법을 출력한다. */
+static void PrintUsage(void) {
+    fprintf(
+        stderr,
+        "usage: %s [-a basic|deviation|hit|nobust] [-b spread] [-c hilo|ko|omega2]"
+        " [-d decks] [-j 3:2|6:5]"
+        " [-l session-length] [-n hands] [-p penetration] [-r bankroll] [-s seed]"
+        " [-t threads] [-B] [-C chart-prefix] [-D] [-H] [-L chart-file] [-M] [-P seats]"
+        " [-R replay] [-S stand-total] [-T tables] [-V] [-W replay]\n",
+        SIM_NAME
+    );
+}
\ No newline at end of file
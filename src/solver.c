@@ -0,0 +1,363 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "b021-engine.h"
+
+/* | `solver` 모듈 매크로 정의... | */
+
+#define CACHE_ENTRY_VALID  0x01
+#define CACHE_ENTRY_ACE    0x02
+#define CACHE_ENTRY_H17    0x04
+
+#define MAX_PROBE_COUNT    8
+
+/* | `solver` 모듈 함수... | */
+
+/* 플레이어가 카드를 그만 받을 때의 기댓값을 계산한다. */
+static double GetStandEv(
+    Solver *solver,
+    const Rules *rules,
+    const RankCounts *counts,
+    int total,
+    int upcard
+);
+
+/* 플레이어가 더블 다운을 할 때의 기댓값을 계산한다. (베팅 금액 1 기준) */
+static double GetDoubleEv(
+    Solver *solver,
+    const Rules *rules,
+    RankCounts *counts,
+    int hardTotal,
+    bool hasAce,
+    int upcard
+);
+
+/* 플레이어 패의 상태에 대해 카드를 그만 받을 때와 카드를 받을 때의 기댓값을 계산한다. */
+static void EvaluateHand(
+    Solver *solver,
+    const Rules *rules,
+    RankCounts *counts,
+    int hardTotal,
+    bool hasAce,
+    int upcard,
+    double *standEv,
+    double *hitEv
+);
+
+/* 블랙잭 게임 전략 계산기를 초기화한다. */
+void InitSolver(Solver *solver) {
+    if (solver == NULL) return;
+
+    memset(solver, 0, sizeof(*solver));
+}
+
+/* 각 행동의 기댓값을 계산하고, 기댓값이 가장 높은 행동을 찾는다. */
+void SolveHand(
+    Solver *solver,
+    const Rules *rules,
+    const Hand *hand,
+    int upcard,
+    const RankCounts *counts,
+    SolverResult *result
+) {
+    if (solver == NULL || rules == NULL || hand == NULL || counts == NULL || result == NULL)
+        return;
+
+    *result = (SolverResult) { .best = PA_STAND };
+
+    if (hand->length == 0 || (hand->flags & HF_BUST)) return;
+
+    RankCounts temp = *counts;
+
+    const int hardTotal = hand->hardTotal;
+    const bool hasAce = hand->flags & HF_ACE;
+
+    double standEv, hitEv;
+
+    EvaluateHand(solver, rules, &temp, hardTotal, hasAce, upcard, &standEv, &hitEv);
+
+    // 내추럴 블랙잭은 딜러가 블랙잭이 아니면 규칙의 배당만큼 이긴다.
+    if (hand->flags & HF_BLACKJACK) standEv = GetBlackjackPayout(rules);
+
+    result->ev[PA_STAND] = standEv;
+    result->available = (1 << PA_STAND);
+
+    if (hand->total < BLACKJACK) {
+        result->ev[PA_HIT] = hitEv;
+        result->available |= (1 << PA_HIT);
+    }
+
+    if (hand->length == 2 && hand->total < BLACKJACK && temp.total > 0) {
+        result->ev[PA_DOUBLE] = GetDoubleEv(
+            solver,
+            rules,
+            &temp,
+            hardTotal,
+            hasAce,
+            upcard
+        );
+        result->available |= (1 << PA_DOUBLE);
+    }
+
+    /*
+        나눈 두 패는 서로 독립적이라고 가정하고, 한 쪽 패의 기댓값의 두 배를
+        계산한다. 에이스를 나눈 경우에는 카드를 한 장씩만 받으며, 나눈 패를
+        다시 나누는 경우는 계산하지 않는다.
+    */
+    if (hand->length == 2 && (hand->flags & HF_PAIR) && rules->splitHandCount >= 2
+        && temp.total > 0) {
+        const int pairRank = GetCardRank(hand->cards[0]);
+
+        double splitEv = 0.0;
+
+        for (int rank = 0; rank < RANK_COUNT; rank++) {
+            if (temp.counts[rank] == 0) continue;
+
+            const double p = (double) temp.counts[rank] / temp.total;
+
+            temp.counts[rank]--, temp.total--;
+
+            const int nextHardTotal = (pairRank + 1) + (rank + 1);
+            const bool nextHasAce = pairRank == 0 || rank == 0;
+
+            EvaluateHand(
+                solver,
+                rules,
+                &temp,
+                nextHardTotal,
+                nextHasAce,
+                upcard,
+                &standEv,
+                &hitEv
+            );
+
+            double ev = (pairRank == 0 || standEv >= hitEv) ? standEv : hitEv;
+
+            // 카드를 나눈 뒤에 더블 다운이 가능하다면, 더블 다운도 고려한다.
+            if (rules->doubleAfterSplit && pairRank != 0 && nextHardTotal < BLACKJACK) {
+                const double doubleEv = GetDoubleEv(
+                    solver,
+                    rules,
+                    &temp,
+                    nextHardTotal,
+                    nextHasAce,
+                    upcard
+                );
+
+                if (doubleEv > ev) ev = doubleEv;
+            }
+
+            temp.counts[rank]++, temp.total++;
+
+            splitEv += p * ev;
+        }
+
+        result->ev[PA_SPLIT] = 2.0 * splitEv;
+        result->available |= (1 << PA_SPLIT);
+    }
+
+    // 서렌더는 딜러가 블랙잭이 아님을 확인한 뒤에 하므로, 항상 절반을 잃는다.
+    if (hand->length == 2 && rules->surrender) {
+        result->ev[PA_SURRENDER] = -0.5;
+        result->available |= (1 << PA_SURRENDER);
+    }
+
+    for (int i = 0; i < _PA_COUNT; i++)
+        if ((result->available & (1 << i)) && result->ev[i] > result->ev[result->best])
+            result->best = i;
+}
+
+/* 플레이어가 카드를 그만 받을 때의 기댓값을 계산한다. */
+static double GetStandEv(
+    Solver *solver,
+    const Rules *rules,
+    const RankCounts *counts,
+    int total,
+    int upcard
+) {
+    DealerDistribution distribution;
+
+    GetDealerDistribution(
+        &solver->dealerCache,
+        counts,
+        upcard,
+        true,
+        rules->dealerHitsSoft17,
+        &distribution
+    );
+
+    double ev = distribution.p[DO_BUST] - distribution.p[DO_BLACKJACK];
+
+    for (int i = DO_17; i <= DO_21; i++) {
+        const int dealerTotal = DEALER_STAND_TOTAL + (i - DO_17);
+
+        if (total > dealerTotal) ev += distribution.p[i];
+        else if (total < dealerTotal) ev -= distribution.p[i];
+    }
+
+    return ev;
+}
+
+/* 플레이어가 더블 다운을 할 때의 기댓값을 계산한다. (베팅 금액 1 기준) */
+static double GetDoubleEv(
+    Solver *solver,
+    const Rules *rules,
+    RankCounts *counts,
+    int hardTotal,
+    bool hasAce,
+    int upcard
+) {
+    if (counts->total <= 0) return -2.0;
+
+    double ev = 0.0;
+
+    for (int rank = 0; rank < RANK_COUNT; rank++) {
+        if (counts->counts[rank] == 0) continue;
+
+        const double p = (double) counts->counts[rank] / counts->total;
+
+        const int nextHardTotal = hardTotal + rank + 1;
+        const bool nextHasAce = hasAce || rank == 0;
+
+        if (nextHardTotal > BLACKJACK) {
+            ev -= p;
+
+            continue;
+        }
+
+        const int nextTotal = (nextHasAce && nextHardTotal <= BLACKJACK - 10)
+            ? nextHardTotal + 10
+            : nextHardTotal;
+
+        counts->counts[rank]--, counts->total--;
+
+        ev += p * GetStandEv(solver, rules, counts, nextTotal, upcard);
+
+        counts->counts[rank]++, counts->total++;
+    }
+
+    return 2.0 * ev;
+}
+
+/* 플레이어 패의 상태에 대해 카드를 그만 받을 때와 카드를 받을 때의 기댓값을 계산한다. */
+static void EvaluateHand(
+    Solver *solver,
+    const Rules *rules,
+    RankCounts *counts,
+    int hardTotal,
+    bool hasAce,
+    int upcard,
+    double *standEv,
+    double *hitEv
+) {
+    const uint8_t flags = CACHE_ENTRY_VALID | (hasAce ? CACHE_ENTRY_ACE : 0)
+        | (rules->dealerHitsSoft17 ? CACHE_ENTRY_H17 : 0);
+
+    const uint64_t hash = HashRankCounts(counts)
+        ^ ((uint64_t) ((hardTotal << 6) | (upcard << 2) | (rules->dealerHitsSoft17 << 1) | hasAce)
+            * 0x9E3779B97F4A7C15ULL);
+
+    SolverCacheEntry *slot = NULL;
+
+    for (int i = 0; i < MAX_PROBE_COUNT; i++) {
+        SolverCacheEntry *entry = &solver->entries[(hash + i) & (SOLVER_CACHE_SIZE - 1)];
+
+        if (!(entry->flags & CACHE_ENTRY_VALID)) {
+            if (slot == NULL) slot = entry;
+
+            continue;
+        }
+
+        if (entry->flags == flags && entry->hardTotal == hardTotal && entry->upcard == upcard
+            && memcmp(entry->counts.counts, counts->counts, sizeof(counts->counts)) == 0) {
+            solver->hits++;
+
+            *standEv = entry->standEv, *hitEv = entry->hitEv;
+
+            return;
+        }
+    }
+
+    // 빈 자리가 없으면 첫 번째 자리의 항목을 교체한다.
+    if (slot == NULL) slot = &solver->entries[hash & (SOLVER_CACHE_SIZE - 1)];
+
+    solver->misses++;
+
+    const int total = (hasAce && hardTotal <= BLACKJACK - 10)
+        ? hardTotal + 10
+        : hardTotal;
+
+    const double stand = GetStandEv(solver, rules, counts, total, upcard);
+
+    // 에이스를 1로 계산해도 21이면, 어떤 카드를 받아도 버스트된다.
+    double hit = -1.0;
+
+    if (hardTotal < BLACKJACK && counts->total > 0) {
+        hit = 0.0;
+
+        for (int rank = 0; rank < RANK_COUNT; rank++) {
+            if (counts->counts[rank] == 0) continue;
+
+            const double p = (double) counts->counts[rank] / counts->total;
+
+            if (hardTotal + rank + 1 > BLACKJACK) {
+                hit -= p;
+
+                continue;
+            }
+
+            double nextStandEv, nextHitEv;
+
+            counts->counts[rank]--, counts->total--;
+
+            EvaluateHand(
+                solver,
+                rules,
+                counts,
+                hardTotal + rank + 1,
+                hasAce || rank == 0,
+                upcard,
+                &nextStandEv,
+                &nextHitEv
+            );
+
+            counts->counts[rank]++, counts->total++;
+
+            hit += p * ((nextStandEv >= nextHitEv) ? nextStandEv : nextHitEv);
+        }
+    }
+
+    // 재귀 호출 도중에 같은 자리가 다른 항목으로 채워졌을 수도 있다.
+    slot->counts = *counts;
+    slot->hardTotal = hardTotal;
+    slot->upcard = upcard;
+    slot->flags = flags;
+    slot->standEv = stand;
+    slot->hitEv = hit;
+
+    *standEv = stand, *hitEv = hit;
+}
\ No newline at end of file
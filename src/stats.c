@@ -0,0 +1,176 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "b021-engine.h"
+
+/* | `stats` 모듈 함수... | */
+
+/* 분위수 스케치에서 값이 속하는 구간의 번호를 반환한다. */
+static int GetSketchBucket(double value);
+
+/* 주어진 범위로 히스토그램을 초기화한다. */
+void InitHistogram(Histogram *histogram, double min, double max) {
+    if (histogram == NULL) return;
+
+    memset(histogram, 0, sizeof(*histogram));
+
+    histogram->min = min, histogram->max = (max > min) ? max : min + 1.0;
+}
+
+/* 히스토그램에 값을 추가한다. */
+void AddHistogramValue(Histogram *histogram, double value) {
+    if (histogram == NULL) return;
+
+    histogram->total++;
+
+    if (value < histogram->min) {
+        histogram->underflow++;
+    } else if (value >= histogram->max) {
+        histogram->overflow++;
+    } else {
+        const int index = (int) (HISTOGRAM_BIN_COUNT * (value - histogram->min)
+            / (histogram->max - histogram->min));
+
+        histogram->counts[(index < HISTOGRAM_BIN_COUNT) ? index : HISTOGRAM_BIN_COUNT - 1]++;
+    }
+}
+
+/* 범위가 같은 히스토그램 `src`의 값들을 `dst`에 합친다. */
+void MergeHistogram(Histogram *dst, const Histogram *src) {
+    if (dst == NULL || src == NULL) return;
+
+    for (int i = 0; i < HISTOGRAM_BIN_COUNT; i++)
+        dst->counts[i] += src->counts[i];
+
+    dst->underflow += src->underflow;
+    dst->overflow += src->overflow;
+    dst->total += src->total;
+}
+
+/*
+    히스토그램에서 `q` (0 ~ 1) 분위수가 속한 구간의 중앙값을 반환한다.
+
+    범위보다 작거나 큰 값은 각각 범위의 최솟값과 최댓값으로 계산한다.
+*/
+double GetHistogramQuantile(const Histogram *histogram, double q) {
+    if (histogram == NULL || histogram->total == 0) return 0.0;
+
+    if (q < 0.0) q = 0.0;
+    else if (q > 1.0) q = 1.0;
+
+    const int64_t rank = (int64_t) (q * (histogram->total - 1));
+
+    int64_t count = histogram->underflow;
+
+    if (rank < count) return histogram->min;
+
+    const double width = (histogram->max - histogram->min) / HISTOGRAM_BIN_COUNT;
+
+    for (int i = 0; i < HISTOGRAM_BIN_COUNT; i++) {
+        count += histogram->counts[i];
+
+        if (rank < count) return histogram->min + width * (i + 0.5);
+    }
+
+    return histogram->max;
+}
+
+/* 분위수 스케치를 초기화한다. */
+void InitQuantileSketch(QuantileSketch *sketch) {
+    if (sketch == NULL) return;
+
+    memset(sketch, 0, sizeof(*sketch));
+}
+
+/* 분위수 스케치에 음이 아닌 값을 추가한다. */
+void AddSketchValue(QuantileSketch *sketch, double value) {
+    if (sketch == NULL) return;
+
+    sketch->count++, sketch->sum += value;
+
+    if (value > sketch->max) sketch->max = value;
+
+    if (value <= SKETCH_MIN_VALUE) sketch->zeroCount++;
+    else sketch->buckets[GetSketchBucket(value)]++;
+}
+
+/* 분위수 스케치 `src`의 값들을 `dst`에 합친다. */
+void MergeQuantileSketch(QuantileSketch *dst, const QuantileSketch *src) {
+    if (dst == NULL || src == NULL) return;
+
+    for (int i = 0; i < SKETCH_BUCKET_COUNT; i++)
+        dst->buckets[i] += src->buckets[i];
+
+    dst->zeroCount += src->zeroCount;
+    dst->count += src->count;
+    dst->sum += src->sum;
+
+    if (src->max > dst->max) dst->max = src->max;
+}
+
+/*
+    분위수 스케치에서 `q` (0 ~ 1) 분위수의 추정값을 반환한다.
+
+    추정값의 상대 오차는 `(SKETCH_GAMMA - 1) / (SKETCH_GAMMA + 1)` 이하이다.
+*/
+double GetSketchQuantile(const QuantileSketch *sketch, double q) {
+    if (sketch == NULL || sketch->count == 0) return 0.0;
+
+    if (q < 0.0) q = 0.0;
+    else if (q > 1.0) q = 1.0;
+
+    const int64_t rank = (int64_t) (q * (sketch->count - 1));
+
+    int64_t count = sketch->zeroCount;
+
+    if (rank < count) return 0.0;
+
+    for (int i = 0; i < SKETCH_BUCKET_COUNT; i++) {
+        count += sketch->buckets[i];
+
+        if (rank >= count) continue;
+
+        // 구간 `(γ^(i - 1), γ^i]`의 값 중 상대 오차가 가장 작은 값을 반환한다.
+        const double value = SKETCH_MIN_VALUE * 2.0 * pow(SKETCH_GAMMA, i)
+            / (SKETCH_GAMMA + 1.0);
+
+        return (value < sketch->max) ? value : sketch->max;
+    }
+
+    return sketch->max;
+}
+
+/* 분위수 스케치에서 값이 속하는 구간의 번호를 반환한다. */
+static int GetSketchBucket(double value) {
+    const int index = (int) ceil(log(value / SKETCH_MIN_VALUE) / log(SKETCH_GAMMA));
+
+    if (index < 0) return 0;
+    else if (index >= SKETCH_BUCKET_COUNT) return SKETCH_BUCKET_COUNT - 1;
+
+    return index;
+}
\ No newline at end of file